@@ -0,0 +1,74 @@
+#pragma once
+
+#include "cstring.h"
+
+#include <cstddef>
+#include <system_error>
+#include <type_traits>
+
+namespace Ubpa::USTL {
+	template<typename T>
+	struct parse_integer_result {
+		T value;
+		std::errc ec; // invalid_argument if no digits, result_out_of_range if value overflows T
+		std::size_t size; // number of characters consumed
+
+		constexpr explicit operator bool() const noexcept { return ec == std::errc{}; }
+	};
+}
+
+#include "details/charconv.inl"
+
+namespace Ubpa::USTL {
+	// runtime counterpart of cstring_integer, same digits (uppercase) and sign
+	// writes no '\0', returns the end of the written characters
+	// out must have room for integer_max_length<T, Base> characters
+	template<std::size_t Base, typename T>
+	constexpr char* write_integer(char* out, T value) noexcept {
+		return details::write_integer<Base>(out, value);
+	}
+
+	// base in [2, 16]
+	template<typename T>
+	constexpr char* write_integer(char* out, T value, std::size_t base) noexcept {
+		assert(2 <= base && base <= 16);
+		return details::write_integer(out, value, base, std::make_index_sequence<15>{});
+	}
+
+	// max number of characters write_integer<Base> produces for T
+	template<typename T, std::size_t Base = 10>
+	constexpr std::size_t integer_max_length = details::integer_max_length<T, Base>;
+
+	// fixed-capacity result of write_integer
+	template<typename T, std::size_t Base = 10>
+	class integer_string : public inplace_string<integer_max_length<T, Base>> {
+		using base_type = inplace_string<integer_max_length<T, Base>>;
+	public:
+		constexpr explicit integer_string(T value) noexcept {
+			char buffer[integer_max_length<T, Base>]{};
+			const char* last = write_integer<Base>(buffer, value);
+			base_type::assign({ buffer, static_cast<std::size_t>(last - buffer) });
+		}
+	};
+
+	namespace details {
+		template<typename T, std::size_t Base>
+		struct is_ustl_string<integer_string<T, Base>> : std::true_type {};
+	}
+
+	// [sign] [prefix] digits
+	// - sign: '+', or '-' if T is signed
+	// - prefix (only if base == 0): "0x"/"0X" -> 16, "0b"/"0B" -> 2, "0" -> 8, otherwise 10
+	// - digits: case-insensitive, stops at the first non-digit
+	// runtime decimal digits are parsed 16 / 8 at a time (SWAR)
+	template<typename T = int>
+	constexpr parse_integer_result<T> parse_integer(std::string_view str, std::size_t base = 0) noexcept {
+		assert(base == 0 || (2 <= base && base <= 16));
+		return details::parse_integer<T>(str, base);
+	}
+
+	// compile-time parse_integer of a constexpr string (cstring, string_view, ...)
+	// ill-formed if the whole string is not a valid integer of type T
+	template<const auto& Str, typename T = int>
+	constexpr T cstring_to_integer = details::cstring_to_integer_<Str, T>();
+}
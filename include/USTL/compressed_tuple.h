@@ -0,0 +1,76 @@
+#pragma once
+
+#include "tuple.h"
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "details/compressed_tuple.inl"
+
+namespace Ubpa::USTL {
+	// std::tuple-like, stored compactly
+	// - every empty non-final element is a base (EBO), so it takes no space
+	// - the other elements are laid out by decreasing alignment, which minimizes padding
+	// get<I> keeps the declared order; supports structured bindings and the tuple.h algorithms
+	template<typename... Ts>
+	class USTL_EMPTY_BASES compressed_tuple
+		: private details::compressed_tuple_storage<typename details::compressed_tuple_order<Ts...>::type, Ts...>
+	{
+		using storage = details::compressed_tuple_storage<typename details::compressed_tuple_order<Ts...>::type, Ts...>;
+
+		template<typename... Us>
+		static constexpr bool is_constructible_from = sizeof...(Us) == sizeof...(Ts) && sizeof...(Us) > 0
+			&& !(sizeof...(Us) == 1 && (std::is_same_v<std::decay_t<Us>, compressed_tuple> || ...));
+
+	public:
+		constexpr compressed_tuple() = default;
+
+		template<typename... Us, std::enable_if_t<is_constructible_from<Us...>, int> = 0>
+		constexpr compressed_tuple(Us&&... us)
+			: storage{ std::in_place, std::forward_as_tuple(std::forward<Us>(us)...) } {}
+
+		template<std::size_t I>
+		constexpr decltype(auto) get() & noexcept { return leaf<I>().get(); }
+		template<std::size_t I>
+		constexpr decltype(auto) get() const& noexcept { return leaf<I>().get(); }
+		template<std::size_t I>
+		constexpr decltype(auto) get() && noexcept { return std::forward<element_type<I>>(leaf<I>().get()); }
+		template<std::size_t I>
+		constexpr decltype(auto) get() const&& noexcept { return std::forward<const element_type<I>>(leaf<I>().get()); }
+
+	private:
+		template<std::size_t I>
+		using element_type = std::tuple_element_t<I, std::tuple<Ts...>>;
+
+		template<std::size_t I>
+		constexpr auto& leaf() noexcept {
+			return static_cast<details::compressed_leaf<I, element_type<I>>&>(*this);
+		}
+		template<std::size_t I>
+		constexpr const auto& leaf() const noexcept {
+			return static_cast<const details::compressed_leaf<I, element_type<I>>&>(*this);
+		}
+	};
+
+	template<typename... Ts>
+	compressed_tuple(Ts...) -> compressed_tuple<Ts...>;
+
+	template<std::size_t I, typename... Ts>
+	constexpr decltype(auto) get(compressed_tuple<Ts...>& t) noexcept { return t.template get<I>(); }
+	template<std::size_t I, typename... Ts>
+	constexpr decltype(auto) get(const compressed_tuple<Ts...>& t) noexcept { return t.template get<I>(); }
+	template<std::size_t I, typename... Ts>
+	constexpr decltype(auto) get(compressed_tuple<Ts...>&& t) noexcept { return std::move(t).template get<I>(); }
+	template<std::size_t I, typename... Ts>
+	constexpr decltype(auto) get(const compressed_tuple<Ts...>&& t) noexcept { return std::move(t).template get<I>(); }
+}
+
+namespace std {
+	template<typename... Ts>
+	struct tuple_size<Ubpa::USTL::compressed_tuple<Ts...>> : integral_constant<size_t, sizeof...(Ts)> {};
+
+	template<size_t I, typename... Ts>
+	struct tuple_element<I, Ubpa::USTL::compressed_tuple<Ts...>> : tuple_element<I, tuple<Ts...>> {};
+}
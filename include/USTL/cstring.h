@@ -1,50 +1,92 @@
 #pragma once
 
+#include "details/simd.inl"
+
 #include <array>
 #include <string_view>
+#include <string>
+#include <tuple>
+#include <iosfwd>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
 #include <cassert>
 
 namespace Ubpa::USTL {
-	template <std::size_t N>
+	// CharT: char, wchar_t, char16_t, char32_t (and char8_t)
+	template <std::size_t N, typename CharT = char>
+	class cstring;
+	template <std::size_t Capacity>
+	class inplace_string;
+
+	namespace details {
+		template<typename T> struct is_char : std::false_type {};
+		template<> struct is_char<char> : std::true_type {};
+		template<> struct is_char<wchar_t> : std::true_type {};
+		template<> struct is_char<char16_t> : std::true_type {};
+		template<> struct is_char<char32_t> : std::true_type {};
+#ifdef __cpp_char8_t
+		template<> struct is_char<char8_t> : std::true_type {};
+#endif
+		template<typename T> constexpr bool is_char_v = is_char<T>::value;
+
+		template<typename T> struct is_ustl_string : std::false_type {};
+		template<std::size_t N, typename CharT> struct is_ustl_string<cstring<N, CharT>> : std::true_type {};
+		template<std::size_t Capacity> struct is_ustl_string<inplace_string<Capacity>> : std::true_type {};
+		template<typename T> constexpr bool is_ustl_string_v = is_ustl_string<T>::value;
+
+		// smallest unsigned type that can hold Capacity
+		template<std::size_t Capacity>
+		using inplace_size_t = std::conditional_t<Capacity <= UINT8_MAX, std::uint8_t,
+			std::conditional_t<Capacity <= UINT16_MAX, std::uint16_t,
+			std::conditional_t<Capacity <= UINT32_MAX, std::uint32_t, std::size_t>>>;
+	}
+
+	template <std::size_t N, typename CharT>
 	class cstring {
 		static_assert(N > 0, "cstring requires size greater than 0.");
 
-		std::array<char, N + 1> chars_;
+		std::array<CharT, N + 1> chars_;
 
 		template <std::size_t... I>
-		constexpr cstring(std::string_view str, std::index_sequence<I...>) noexcept : chars_{ {str[I]..., '\0'} } {}
+		constexpr cstring(std::basic_string_view<CharT> str, std::index_sequence<I...>) noexcept : chars_{ {str[I]..., CharT{}} } {}
 
 		template <std::size_t... N1, std::size_t... N2>
 		constexpr cstring(
-			std::string_view a, std::index_sequence<N1...>,
-			std::string_view b, std::index_sequence<N2...>
-		) noexcept : chars_{ {a[N1]..., b[N2]..., '\0'} } {}
+			std::basic_string_view<CharT> a, std::index_sequence<N1...>,
+			std::basic_string_view<CharT> b, std::index_sequence<N2...>
+		) noexcept : chars_{ {a[N1]..., b[N2]..., CharT{}} } {}
 
 	public:
-		using value_type = const char;
+		using char_type = CharT;
+		using view_type = std::basic_string_view<CharT>;
+
+		using value_type = const CharT;
 		using size_type = std::size_t;
 		using difference_type = std::ptrdiff_t;
-		using pointer = const char*;
-		using const_pointer = const char*;
-		using reference = const char&;
-		using const_reference = const char&;
+		using pointer = const CharT*;
+		using const_pointer = const CharT*;
+		using reference = const CharT&;
+		using const_reference = const CharT&;
 
-		using iterator = const char*;
-		using const_iterator = const char*;
+		using iterator = const CharT*;
+		using const_iterator = const CharT*;
 
 		using reverse_iterator = std::reverse_iterator<iterator>;
 		using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
-		constexpr explicit cstring(char c) noexcept : chars_{ {c,'\0'} } {
+		static constexpr size_type npos = static_cast<size_type>(-1);
+
+		constexpr explicit cstring(CharT c) noexcept : chars_{ {c, CharT{}} } {
 			static_assert(N == 1);
 		}
 
-		constexpr explicit cstring(std::string_view str) noexcept : cstring{ str, std::make_index_sequence<N>{} } {
+		constexpr explicit cstring(view_type str) noexcept : cstring{ str, std::make_index_sequence<N>{} } {
 			assert(str.size() == N);
 		}
 
 		template<size_t N1, size_t N2>
-		constexpr explicit cstring(cstring<N1> a, cstring<N2> b) noexcept
+		constexpr explicit cstring(cstring<N1, CharT> a, cstring<N2, CharT> b) noexcept
 			: cstring{ a, std::make_index_sequence<N1>{}, b, std::make_index_sequence<N2>{} }
 		{
 			static_assert(N1 + N2 == N);
@@ -88,14 +130,307 @@ namespace Ubpa::USTL {
 
 		constexpr const_reference front() const noexcept { return chars_[0]; }
 
-		constexpr const_reference back() const noexcept { return chars_[N]; }
+		constexpr const_reference back() const noexcept { return chars_[N - 1]; }
 
 		constexpr size_type length() const noexcept { return size(); }
 
 		constexpr bool empty() const noexcept { return false; }
 
+		constexpr int compare(view_type str) const noexcept {
+			return details::str_compare(view_type{ data(), size() }, str);
+		}
+
+		constexpr size_type find(CharT c, size_type pos = 0) const noexcept {
+			return details::str_find(view_type{ *this }, c, pos);
+		}
+
+		constexpr size_type find(view_type str, size_type pos = 0) const noexcept {
+			return details::str_find(view_type{ *this }, str, pos);
+		}
+
+		constexpr size_type rfind(CharT c, size_type pos = npos) const noexcept {
+			return details::str_rfind(view_type{ *this }, c, pos);
+		}
+
+		constexpr size_type rfind(view_type str, size_type pos = npos) const noexcept {
+			return view_type{ *this }.rfind(str, pos);
+		}
+
+		constexpr bool starts_with(CharT c) const noexcept { return front() == c; }
+
+		constexpr bool starts_with(view_type str) const noexcept {
+			return str.size() <= size() && details::str_equal(view_type{ data(), str.size() }, str);
+		}
+
+		constexpr bool ends_with(CharT c) const noexcept { return back() == c; }
+
+		constexpr bool ends_with(view_type str) const noexcept {
+			return str.size() <= size() && details::str_equal(view_type{ data() + size() - str.size(), str.size() }, str);
+		}
+
+		constexpr bool contains(CharT c) const noexcept { return find(c) != npos; }
+
+		constexpr bool contains(view_type str) const noexcept { return find(str) != npos; }
+
+		// compile-time slicing, Len > 0
+		template<size_type Pos, size_type Len = N - Pos>
+		constexpr cstring<Len, CharT> substr() const noexcept {
+			static_assert(Pos + Len <= N, "cstring::substr out of range.");
+			return cstring<Len, CharT>{ view_type{ data() + Pos, Len } };
+		}
+
+		constexpr view_type substr(size_type pos, size_type count = npos) const noexcept {
+			return assert(pos <= size()), view_type{ *this }.substr(pos, count);
+		}
+
+		constexpr const CharT* c_str() const noexcept { return data(); }
+
+		template <typename Char = CharT, typename Traits = std::char_traits<Char>, typename Allocator = std::allocator<Char>>
+		std::basic_string<Char, Traits, Allocator> str() const { return { begin(), end() }; }
+
+		constexpr operator view_type() const noexcept { return { data(), size() }; }
+
+		constexpr explicit operator const CharT* () const noexcept { return data(); }
+
+		template <typename Char = CharT, typename Traits = std::char_traits<Char>, typename Allocator = std::allocator<Char>>
+		explicit operator std::basic_string<Char, Traits, Allocator>() const { return { begin(), end() }; }
+	};
+
+	template <typename CharT, std::size_t N>
+	using basic_cstring = cstring<N, CharT>;
+
+	cstring(char)->cstring<1>;
+	template<typename CharT, std::enable_if_t<details::is_char_v<CharT> && !std::is_same_v<CharT, char>, int> = 0>
+	cstring(CharT)->cstring<1, CharT>;
+	template<typename CharT, size_t N>
+	cstring(const CharT(&)[N])->cstring<N - 1, CharT>;
+	template<typename CharT, size_t N1, size_t N2>
+	cstring(const CharT(&)[N1], const CharT(&)[N2])->cstring<N1 + N2 - 2, CharT>;
+	template<typename CharT, size_t N1, size_t N2>
+	cstring(cstring<N1, CharT>, cstring<N2, CharT>)->cstring<N1 + N2, CharT>;
+
+	// mutable string with fixed capacity, stores its length inline and never allocates
+	template <std::size_t Capacity>
+	class inplace_string {
+		std::array<char, Capacity + 1> chars_{};
+		details::inplace_size_t<Capacity> size_{ 0 };
+
+	public:
+		using char_type = char;
+		using view_type = std::string_view;
+
+		using value_type = char;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using pointer = char*;
+		using const_pointer = const char*;
+		using reference = char&;
+		using const_reference = const char&;
+
+		using iterator = char*;
+		using const_iterator = const char*;
+
+		using reverse_iterator = std::reverse_iterator<iterator>;
+		using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+		static constexpr size_type npos = static_cast<size_type>(-1);
+
+		constexpr inplace_string() noexcept = default;
+
+		constexpr explicit inplace_string(std::string_view str) noexcept { assign(str); }
+
+		constexpr inplace_string(size_type count, char c) noexcept { assign(count, c); }
+
+		template<std::size_t N>
+		constexpr inplace_string(const char(&str)[N]) noexcept : inplace_string{ std::string_view{ str, N - 1 } } {
+			static_assert(N - 1 <= Capacity, "inplace_string capacity exceeded.");
+		}
+
+		template<std::size_t N>
+		constexpr inplace_string(const cstring<N>& str) noexcept : inplace_string{ std::string_view{ str } } {
+			static_assert(N <= Capacity, "inplace_string capacity exceeded.");
+		}
+
+		constexpr inplace_string(const inplace_string&) = default;
+
+		constexpr inplace_string(inplace_string&&) = default;
+
+		~inplace_string() = default;
+
+		constexpr inplace_string& operator=(const inplace_string&) = default;
+
+		constexpr inplace_string& operator=(inplace_string&&) = default;
+
+		constexpr inplace_string& operator=(std::string_view str) noexcept { return assign(str); }
+
+		template<std::size_t N>
+		constexpr inplace_string& operator=(const char(&str)[N]) noexcept { return *this = inplace_string{ str }; }
+
+		template<std::size_t N>
+		constexpr inplace_string& operator=(const cstring<N>& str) noexcept { return *this = inplace_string{ str }; }
+
+		constexpr inplace_string& assign(std::string_view str) noexcept {
+			assert(str.size() <= Capacity);
+			details::str_copy(chars_.data(), str.data(), str.size());
+			set_size(str.size());
+			return *this;
+		}
+
+		constexpr inplace_string& assign(size_type count, char c) noexcept {
+			assert(count <= Capacity);
+			for (size_type i = 0; i < count; i++)
+				chars_[i] = c;
+			set_size(count);
+			return *this;
+		}
+
+		constexpr pointer data() noexcept { return chars_.data(); }
+
+		constexpr const_pointer data() const noexcept { return chars_.data(); }
+
+		constexpr size_type size() const noexcept { return size_; }
+
+		constexpr size_type length() const noexcept { return size(); }
+
+		static constexpr size_type capacity() noexcept { return Capacity; }
+
+		static constexpr size_type max_size() noexcept { return Capacity; }
+
+		constexpr bool empty() const noexcept { return size() == 0; }
+
+		constexpr bool full() const noexcept { return size() == Capacity; }
+
+		constexpr iterator begin() noexcept { return data(); }
+
+		constexpr const_iterator begin() const noexcept { return data(); }
+
+		constexpr iterator end() noexcept { return data() + size(); }
+
+		constexpr const_iterator end() const noexcept { return data() + size(); }
+
+		constexpr const_iterator cbegin() const noexcept { return begin(); }
+
+		constexpr const_iterator cend() const noexcept { return end(); }
+
+		constexpr reverse_iterator rbegin() noexcept { return reverse_iterator{ end() }; }
+
+		constexpr const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator{ end() }; }
+
+		constexpr reverse_iterator rend() noexcept { return reverse_iterator{ begin() }; }
+
+		constexpr const_reverse_iterator rend() const noexcept { return const_reverse_iterator{ begin() }; }
+
+		constexpr const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+
+		constexpr const_reverse_iterator crend() const noexcept { return rend(); }
+
+		constexpr reference operator[](size_type i) noexcept { return assert(i < size()), chars_[i]; }
+
+		constexpr const_reference operator[](size_type i) const noexcept { return assert(i < size()), chars_[i]; }
+
+		constexpr reference at(size_type i) { return assert(i < size()), chars_.at(i); }
+
+		constexpr const_reference at(size_type i) const { return assert(i < size()), chars_.at(i); }
+
+		constexpr reference front() noexcept { return (*this)[0]; }
+
+		constexpr const_reference front() const noexcept { return (*this)[0]; }
+
+		constexpr reference back() noexcept { return (*this)[size() - 1]; }
+
+		constexpr const_reference back() const noexcept { return (*this)[size() - 1]; }
+
+		constexpr void clear() noexcept { set_size(0); }
+
+		constexpr void push_back(char c) noexcept {
+			assert(!full());
+			chars_[size_] = c;
+			set_size(size() + 1);
+		}
+
+		constexpr void pop_back() noexcept {
+			assert(!empty());
+			set_size(size() - 1);
+		}
+
+		constexpr inplace_string& append(std::string_view str) noexcept {
+			assert(size() + str.size() <= Capacity);
+			details::str_copy(chars_.data() + size(), str.data(), str.size());
+			set_size(size() + str.size());
+			return *this;
+		}
+
+		constexpr inplace_string& append(size_type count, char c) noexcept {
+			assert(size() + count <= Capacity);
+			for (size_type i = size(); i < size() + count; i++)
+				chars_[i] = c;
+			set_size(size() + count);
+			return *this;
+		}
+
+		constexpr inplace_string& operator+=(std::string_view str) noexcept { return append(str); }
+
+		constexpr inplace_string& operator+=(char c) noexcept { return push_back(c), *this; }
+
+		constexpr inplace_string& erase(size_type pos = 0, size_type count = npos) noexcept {
+			assert(pos <= size());
+			const size_type n = count < size() - pos ? count : size() - pos;
+			details::str_copy(chars_.data() + pos, chars_.data() + pos + n, size() - pos - n);
+			set_size(size() - n);
+			return *this;
+		}
+
+		constexpr void resize(size_type count, char c = '\0') noexcept {
+			if (count > size())
+				append(count - size(), c);
+			else
+				set_size(count);
+		}
+
+		constexpr void swap(inplace_string& other) noexcept {
+			inplace_string tmp{ *this };
+			*this = other;
+			other = tmp;
+		}
+
+		constexpr size_type find(char c, size_type pos = 0) const noexcept {
+			return details::str_find(*this, c, pos);
+		}
+
+		constexpr size_type find(std::string_view str, size_type pos = 0) const noexcept {
+			return details::str_find(*this, str, pos);
+		}
+
+		constexpr size_type rfind(char c, size_type pos = npos) const noexcept {
+			return details::str_rfind(*this, c, pos);
+		}
+
+		constexpr size_type rfind(std::string_view str, size_type pos = npos) const noexcept {
+			return std::string_view{ *this }.rfind(str, pos);
+		}
+
+		constexpr bool starts_with(char c) const noexcept { return !empty() && front() == c; }
+
+		constexpr bool starts_with(std::string_view str) const noexcept {
+			return str.size() <= size() && details::str_equal({ data(), str.size() }, str);
+		}
+
+		constexpr bool ends_with(char c) const noexcept { return !empty() && back() == c; }
+
+		constexpr bool ends_with(std::string_view str) const noexcept {
+			return str.size() <= size() && details::str_equal({ data() + size() - str.size(), str.size() }, str);
+		}
+
+		constexpr bool contains(char c) const noexcept { return find(c) != npos; }
+
+		constexpr bool contains(std::string_view str) const noexcept { return find(str) != npos; }
+
+		constexpr std::string_view substr(size_type pos, size_type count = npos) const noexcept {
+			return assert(pos <= size()), std::string_view{ *this }.substr(pos, count);
+		}
+
 		constexpr int compare(std::string_view str) const noexcept {
-			return std::string_view{ data(), size() }.compare(str);
+			return details::str_compare(*this, str);
 		}
 
 		constexpr const char* c_str() const noexcept { return data(); }
@@ -109,98 +444,174 @@ namespace Ubpa::USTL {
 
 		template <typename Char = char, typename Traits = std::char_traits<Char>, typename Allocator = std::allocator<Char>>
 		explicit operator std::basic_string<Char, Traits, Allocator>() const { return { begin(), end() }; }
+
+	private:
+		constexpr void set_size(size_type n) noexcept {
+			size_ = static_cast<details::inplace_size_t<Capacity>>(n);
+			chars_[n] = '\0';
+		}
 	};
 
-	cstring(char)->cstring<1>;
 	template<size_t N>
-	cstring(const char(&)[N])->cstring<N - 1>;
-	template<size_t N1, size_t N2>
-	cstring(const char(&)[N1], const char(&)[N2])->cstring<N1 + N2 - 2>;
-	template<size_t N1, size_t N2>
-	cstring(cstring<N1>, cstring<N2>)->cstring<N1 + N2>;
+	inplace_string(const char(&)[N])->inplace_string<N - 1>;
+	template<size_t N>
+	inplace_string(cstring<N>)->inplace_string<N>;
+
+	// [relational operators]
+	// shared by cstring and inplace_string, compare with the view of the same char type
 
-	template <std::size_t N>
-	constexpr bool operator==(const cstring<N>& lhs, std::string_view rhs) noexcept {
-		return lhs.compare(rhs) == 0;
+	template <typename Str, std::enable_if_t<details::is_ustl_string_v<Str>, int> = 0>
+	constexpr bool operator==(const Str& lhs, typename Str::view_type rhs) noexcept {
+		return details::str_equal(typename Str::view_type{ lhs }, rhs);
 	}
 
-	template <std::size_t N>
-	constexpr bool operator==(std::string_view lhs, const cstring<N>& rhs) noexcept {
-		return lhs.compare(rhs) == 0;
+	template <typename Str, std::enable_if_t<details::is_ustl_string_v<Str>, int> = 0>
+	constexpr bool operator==(typename Str::view_type lhs, const Str& rhs) noexcept {
+		return details::str_equal(lhs, typename Str::view_type{ rhs });
 	}
 
-	template <std::size_t N>
-	constexpr bool operator!=(const cstring<N>& lhs, std::string_view rhs) noexcept {
-		return lhs.compare(rhs) != 0;
+	template <typename Lhs, typename Rhs, std::enable_if_t<details::is_ustl_string_v<Lhs> && details::is_ustl_string_v<Rhs>, int> = 0>
+	constexpr bool operator==(const Lhs& lhs, const Rhs& rhs) noexcept {
+		static_assert(std::is_same_v<typename Lhs::char_type, typename Rhs::char_type>);
+		return details::str_equal(typename Lhs::view_type{ lhs }, typename Rhs::view_type{ rhs });
 	}
 
-	template <std::size_t N>
-	constexpr bool operator!=(std::string_view lhs, const cstring<N>& rhs) noexcept {
-		return lhs.compare(rhs) != 0;
+	template <typename Str, std::enable_if_t<details::is_ustl_string_v<Str>, int> = 0>
+	constexpr bool operator!=(const Str& lhs, typename Str::view_type rhs) noexcept {
+		return !details::str_equal(typename Str::view_type{ lhs }, rhs);
 	}
 
-	template <std::size_t N>
-	constexpr bool operator>(const cstring<N>& lhs, std::string_view rhs) noexcept {
-		return lhs.compare(rhs) > 0;
+	template <typename Str, std::enable_if_t<details::is_ustl_string_v<Str>, int> = 0>
+	constexpr bool operator!=(typename Str::view_type lhs, const Str& rhs) noexcept {
+		return !details::str_equal(lhs, typename Str::view_type{ rhs });
 	}
 
-	template <std::size_t N>
-	constexpr bool operator>(std::string_view lhs, const cstring<N>& rhs) noexcept {
-		return lhs.compare(rhs) > 0;
+	template <typename Lhs, typename Rhs, std::enable_if_t<details::is_ustl_string_v<Lhs> && details::is_ustl_string_v<Rhs>, int> = 0>
+	constexpr bool operator!=(const Lhs& lhs, const Rhs& rhs) noexcept {
+		static_assert(std::is_same_v<typename Lhs::char_type, typename Rhs::char_type>);
+		return !details::str_equal(typename Lhs::view_type{ lhs }, typename Rhs::view_type{ rhs });
 	}
 
-	template <std::size_t N>
-	constexpr bool operator>=(const cstring<N>& lhs, std::string_view rhs) noexcept {
-		return lhs.compare(rhs) >= 0;
+	template <typename Str, std::enable_if_t<details::is_ustl_string_v<Str>, int> = 0>
+	constexpr bool operator>(const Str& lhs, typename Str::view_type rhs) noexcept {
+		return details::str_compare(typename Str::view_type{ lhs }, rhs) > 0;
 	}
 
-	template <std::size_t N>
-	constexpr bool operator>=(std::string_view lhs, const cstring<N>& rhs) noexcept {
-		return lhs.compare(rhs) >= 0;
+	template <typename Str, std::enable_if_t<details::is_ustl_string_v<Str>, int> = 0>
+	constexpr bool operator>(typename Str::view_type lhs, const Str& rhs) noexcept {
+		return details::str_compare(lhs, typename Str::view_type{ rhs }) > 0;
 	}
 
-	template <std::size_t N>
-	constexpr bool operator<(const cstring<N>& lhs, std::string_view rhs) noexcept {
-		return lhs.compare(rhs) < 0;
+	template <typename Lhs, typename Rhs, std::enable_if_t<details::is_ustl_string_v<Lhs> && details::is_ustl_string_v<Rhs>, int> = 0>
+	constexpr bool operator>(const Lhs& lhs, const Rhs& rhs) noexcept {
+		static_assert(std::is_same_v<typename Lhs::char_type, typename Rhs::char_type>);
+		return details::str_compare(typename Lhs::view_type{ lhs }, typename Rhs::view_type{ rhs }) > 0;
 	}
 
-	template <std::size_t N>
-	constexpr bool operator<(std::string_view lhs, const cstring<N>& rhs) noexcept {
-		return lhs.compare(rhs) < 0;
+	template <typename Str, std::enable_if_t<details::is_ustl_string_v<Str>, int> = 0>
+	constexpr bool operator>=(const Str& lhs, typename Str::view_type rhs) noexcept {
+		return details::str_compare(typename Str::view_type{ lhs }, rhs) >= 0;
 	}
 
-	template <std::size_t N>
-	constexpr bool operator<=(const cstring<N>& lhs, std::string_view rhs) noexcept {
-		return lhs.compare(rhs) <= 0;
+	template <typename Str, std::enable_if_t<details::is_ustl_string_v<Str>, int> = 0>
+	constexpr bool operator>=(typename Str::view_type lhs, const Str& rhs) noexcept {
+		return details::str_compare(lhs, typename Str::view_type{ rhs }) >= 0;
 	}
 
-	template <std::size_t N>
-	constexpr bool operator<=(std::string_view lhs, const cstring<N>& rhs) noexcept {
-		return lhs.compare(rhs) <= 0;
+	template <typename Lhs, typename Rhs, std::enable_if_t<details::is_ustl_string_v<Lhs> && details::is_ustl_string_v<Rhs>, int> = 0>
+	constexpr bool operator>=(const Lhs& lhs, const Rhs& rhs) noexcept {
+		static_assert(std::is_same_v<typename Lhs::char_type, typename Rhs::char_type>);
+		return details::str_compare(typename Lhs::view_type{ lhs }, typename Rhs::view_type{ rhs }) >= 0;
 	}
 
-	template <typename Char, typename Traits, std::size_t N>
-	std::basic_ostream<Char, Traits>& operator<<(std::basic_ostream<Char, Traits>& os, const cstring<N>& str) {
-		for (const auto c : std::string_view{ str })
-			os.put(c);
+	template <typename Str, std::enable_if_t<details::is_ustl_string_v<Str>, int> = 0>
+	constexpr bool operator<(const Str& lhs, typename Str::view_type rhs) noexcept {
+		return details::str_compare(typename Str::view_type{ lhs }, rhs) < 0;
+	}
+
+	template <typename Str, std::enable_if_t<details::is_ustl_string_v<Str>, int> = 0>
+	constexpr bool operator<(typename Str::view_type lhs, const Str& rhs) noexcept {
+		return details::str_compare(lhs, typename Str::view_type{ rhs }) < 0;
+	}
+
+	template <typename Lhs, typename Rhs, std::enable_if_t<details::is_ustl_string_v<Lhs> && details::is_ustl_string_v<Rhs>, int> = 0>
+	constexpr bool operator<(const Lhs& lhs, const Rhs& rhs) noexcept {
+		static_assert(std::is_same_v<typename Lhs::char_type, typename Rhs::char_type>);
+		return details::str_compare(typename Lhs::view_type{ lhs }, typename Rhs::view_type{ rhs }) < 0;
+	}
+
+	template <typename Str, std::enable_if_t<details::is_ustl_string_v<Str>, int> = 0>
+	constexpr bool operator<=(const Str& lhs, typename Str::view_type rhs) noexcept {
+		return details::str_compare(typename Str::view_type{ lhs }, rhs) <= 0;
+	}
+
+	template <typename Str, std::enable_if_t<details::is_ustl_string_v<Str>, int> = 0>
+	constexpr bool operator<=(typename Str::view_type lhs, const Str& rhs) noexcept {
+		return details::str_compare(lhs, typename Str::view_type{ rhs }) <= 0;
+	}
+
+	template <typename Lhs, typename Rhs, std::enable_if_t<details::is_ustl_string_v<Lhs> && details::is_ustl_string_v<Rhs>, int> = 0>
+	constexpr bool operator<=(const Lhs& lhs, const Rhs& rhs) noexcept {
+		static_assert(std::is_same_v<typename Lhs::char_type, typename Rhs::char_type>);
+		return details::str_compare(typename Lhs::view_type{ lhs }, typename Rhs::view_type{ rhs }) <= 0;
+	}
+
+	// a char string is widened into other streams, any other char_type must match the stream's
+	template <typename Char, typename Traits, typename Str, std::enable_if_t<details::is_ustl_string_v<Str>, int> = 0>
+	std::basic_ostream<Char, Traits>& operator<<(std::basic_ostream<Char, Traits>& os, const Str& str) {
+		const typename Str::view_type view{ str };
+		if constexpr (std::is_same_v<typename Str::char_type, Char>)
+			os.write(view.data(), static_cast<std::streamsize>(view.size()));
+		else {
+			static_assert(std::is_same_v<typename Str::char_type, char>,
+				"operator<<: the string's char_type must be char or the stream's.");
+			for (const auto c : view)
+				os.put(os.widen(c));
+		}
 
 		return os;
 	}
+
+	// 64-bit FNV-1a, usable at compile time (type_id, string IDs)
+	constexpr std::uint64_t string_hash(std::string_view str) noexcept {
+		std::uint64_t hash = 14695981039346656037ull;
+		for (const auto c : str) {
+			hash ^= static_cast<unsigned char>(c);
+			hash *= 1099511628211ull;
+		}
+		return hash;
+	}
 }
 
 namespace std {
-	template<size_t Index, size_t N>
-	constexpr char get(Ubpa::USTL::cstring<N> cstr) noexcept {
+	template<size_t Index, size_t N, typename CharT>
+	constexpr CharT get(Ubpa::USTL::cstring<N, CharT> cstr) noexcept {
 		static_assert(Index < N);
 		return cstr[Index];
 	}
+
+	template<size_t Capacity>
+	struct hash<Ubpa::USTL::inplace_string<Capacity>> {
+		size_t operator()(const Ubpa::USTL::inplace_string<Capacity>& str) const noexcept {
+			return hash<string_view>{}(str);
+		}
+	};
 }
 
 #include "details/cstring.inl"
 
 namespace Ubpa::USTL
 {
-	// 2-10, 16
+	// 2-16
 	template<auto Num, size_t System = 10>
 	constexpr auto cstring_integer = details::cstring_integer_<Num, System>();
 }
+
+namespace Ubpa::USTL
+{
+	// split a constexpr string (cstring, string_view, ...) into a std::tuple of cstrings
+	// empty segments are skipped, e.g. "/a//b" -> { "a", "b" }
+	template<const auto& Str, char Delim>
+	constexpr auto cstring_split = details::cstring_split_<Str, Delim>::get(
+		std::make_index_sequence<details::cstring_split_<Str, Delim>::count>{});
+}
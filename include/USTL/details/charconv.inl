@@ -0,0 +1,322 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace Ubpa::USTL::details {
+	template<std::size_t Base>
+	constexpr void check_integer_base() noexcept {
+		static_assert(2 <= Base && Base <= 16, "integer base must be in [2, 16].");
+	}
+
+	template<std::size_t Base>
+	constexpr auto integer_digit_pairs_() noexcept {
+		std::array<char, 2 * Base * Base> pairs{};
+		for (std::size_t i = 0; i < Base * Base; i++) {
+			pairs[2 * i] = integer_digit(static_cast<unsigned>(i / Base));
+			pairs[2 * i + 1] = integer_digit(static_cast<unsigned>(i % Base));
+		}
+		return pairs;
+	}
+
+	// "00", "01", ..., two digits per entry
+	template<std::size_t Base>
+	constexpr auto integer_digit_pairs = integer_digit_pairs_<Base>();
+
+	template<typename U, std::size_t Base>
+	constexpr std::size_t integer_max_digits_() noexcept {
+		std::size_t n = 1;
+		for (U v = std::numeric_limits<U>::max(); v >= Base; v /= Base)
+			n++;
+		return n;
+	}
+
+	template<typename T, std::size_t Base>
+	constexpr std::size_t integer_max_length = integer_max_digits_<std::make_unsigned_t<T>, Base>()
+		+ (std::is_signed_v<T> ? 1 : 0);
+
+	// Base^0, Base^1, ..., Base^(digits - 1)
+	template<typename U, std::size_t Base>
+	constexpr auto integer_powers_() noexcept {
+		std::array<U, integer_max_digits_<U, Base>()> powers{};
+		U p = 1;
+		for (std::size_t i = 0; i < powers.size(); i++, p *= static_cast<U>(Base))
+			powers[i] = p;
+		return powers;
+	}
+
+	template<typename U, std::size_t Base>
+	constexpr auto integer_powers = integer_powers_<U, Base>();
+
+	constexpr unsigned integer_log2(std::size_t Base) noexcept {
+		unsigned n = 0;
+		while ((std::size_t{ 1 } << n) < Base)
+			n++;
+		return n;
+	}
+
+	template<typename U>
+	constexpr unsigned bit_width(U v) noexcept {
+		unsigned n = 0;
+		for (; v != 0; v >>= 1)
+			n++;
+		return n;
+	}
+
+	template<typename U>
+	inline unsigned runtime_bit_width(U v) noexcept {
+		static_assert(std::is_unsigned_v<U>);
+		if (v == 0)
+			return 0;
+#if defined(_MSC_VER) && !defined(__clang__)
+		unsigned long idx;
+		if constexpr (sizeof(U) <= 4)
+			_BitScanReverse(&idx, static_cast<unsigned long>(v));
+		else
+			_BitScanReverse64(&idx, static_cast<unsigned long long>(v));
+		return static_cast<unsigned>(idx) + 1;
+#else
+		if constexpr (sizeof(U) <= sizeof(unsigned))
+			return static_cast<unsigned>(std::numeric_limits<unsigned>::digits - __builtin_clz(static_cast<unsigned>(v)));
+		else
+			return static_cast<unsigned>(std::numeric_limits<unsigned long long>::digits - __builtin_clzll(static_cast<unsigned long long>(v)));
+#endif
+	}
+
+	// number of digits of v in Base, v == 0 has 1 digit
+	template<std::size_t Base, typename U>
+	constexpr unsigned integer_length(U v) noexcept {
+		static_assert(std::is_unsigned_v<U>);
+		if constexpr ((Base & (Base - 1)) == 0) {
+			constexpr unsigned shift = integer_log2(Base);
+			const unsigned width = USTL_IS_CONSTANT_EVALUATED() ? bit_width(v) : runtime_bit_width(v);
+			return (width + (width == 0) + shift - 1) / shift;
+		}
+		else if constexpr (Base == 10) {
+			// log10(2) ~ 1233 / 4096, then fix the guess by one comparison
+			const unsigned width = USTL_IS_CONSTANT_EVALUATED() ? bit_width(v) : runtime_bit_width(v);
+			const unsigned guess = (width * 1233) >> 12;
+			return guess + 1 - (v < integer_powers<U, 10>[guess]) + (v == 0);
+		}
+		else {
+			unsigned n = 1;
+			for (std::size_t i = 1; i < integer_powers<U, Base>.size(); i++)
+				n += v >= integer_powers<U, Base>[i];
+			return n;
+		}
+	}
+
+	// writes exactly len digits ending at last
+	template<std::size_t Base, typename U>
+	constexpr void write_unsigned_backward(char* last, U v) noexcept {
+		constexpr U base = static_cast<U>(Base);
+		constexpr U base2 = static_cast<U>(Base * Base);
+		while (v >= base2) {
+			const auto idx = static_cast<std::size_t>(v % base2) * 2;
+			v /= base2;
+			*--last = integer_digit_pairs<Base>[idx + 1];
+			*--last = integer_digit_pairs<Base>[idx];
+		}
+		if (v >= base) {
+			const auto idx = static_cast<std::size_t>(v) * 2;
+			*--last = integer_digit_pairs<Base>[idx + 1];
+			*--last = integer_digit_pairs<Base>[idx];
+		}
+		else
+			*--last = integer_digit(static_cast<unsigned>(v));
+	}
+
+	template<std::size_t Base, typename T>
+	constexpr char* write_integer(char* out, T value) noexcept {
+		check_integer_base<Base>();
+		static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>);
+		using U = std::make_unsigned_t<T>;
+		U v = static_cast<U>(value);
+		if constexpr (std::is_signed_v<T>) {
+			if (value < 0) {
+				*out++ = '-';
+				v = static_cast<U>(U{ 0 } - v);
+			}
+		}
+		const unsigned len = integer_length<Base>(v);
+		write_unsigned_backward<Base>(out + len, v);
+		return out + len;
+	}
+
+	template<typename T, std::size_t... Bases>
+	constexpr char* write_integer(char* out, T value, std::size_t base, std::index_sequence<Bases...>) noexcept {
+		char* last = nullptr;
+		((base == Bases + 2 ? (last = write_integer<Bases + 2>(out, value), true) : false) || ...);
+		return last;
+	}
+
+	// [parse]
+
+	constexpr unsigned parse_digit(char c) noexcept {
+		if ('0' <= c && c <= '9')
+			return static_cast<unsigned>(c - '0');
+		if ('a' <= c && c <= 'f')
+			return static_cast<unsigned>(c - 'a' + 10);
+		if ('A' <= c && c <= 'F')
+			return static_cast<unsigned>(c - 'A' + 10);
+		return 16;
+	}
+
+	// 8 ASCII decimal digits (little-endian load) -> value, chunk must pass is_8_digits
+	inline std::uint64_t parse_8_digits(std::uint64_t chunk) noexcept {
+		chunk -= 0x3030303030303030ull;
+		chunk = (chunk * 10) + (chunk >> 8);
+		chunk = (((chunk & 0x000000FF000000FFull) * (100 + (1000000ull << 32)))
+			+ (((chunk >> 16) & 0x000000FF000000FFull) * (1 + (10000ull << 32)))) >> 32;
+		return chunk;
+	}
+
+	inline bool is_8_digits(std::uint64_t chunk) noexcept {
+		return ((chunk & 0xF0F0F0F0F0F0F0F0ull)
+			| (((chunk + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4)) == 0x3333333333333333ull;
+	}
+
+	inline std::uint64_t load_8_chars(const char* str) noexcept {
+		std::uint64_t chunk;
+		std::memcpy(&chunk, str, 8);
+		return chunk;
+	}
+
+	// consumes decimal digits of str from i in 16 / 8 digit chunks while acc can't overflow
+	// returns the number of digits consumed
+	inline std::size_t parse_decimal_chunks(std::string_view str, std::size_t i, std::uint64_t& acc) noexcept {
+		const std::size_t begin = i;
+		// 10^19 < 2^64, so up to 19 digits never overflow
+		if (i + 16 <= str.size()) {
+			const std::uint64_t hi = load_8_chars(str.data() + i);
+			const std::uint64_t lo = load_8_chars(str.data() + i + 8);
+			if (is_8_digits(hi) && is_8_digits(lo)) {
+				acc = parse_8_digits(hi) * 100000000ull + parse_8_digits(lo);
+				i += 16;
+			}
+		}
+		if (i == begin && i + 8 <= str.size()) {
+			const std::uint64_t chunk = load_8_chars(str.data() + i);
+			if (is_8_digits(chunk)) {
+				acc = parse_8_digits(chunk);
+				i += 8;
+				if (i + 8 <= str.size()) {
+					const std::uint64_t next = load_8_chars(str.data() + i);
+					if (is_8_digits(next)) {
+						acc = acc * 100000000ull + parse_8_digits(next);
+						i += 8;
+					}
+				}
+			}
+		}
+		return i - begin;
+	}
+
+	// Base == 0 for a runtime base, returns the end of the digits
+	// the first `unchecked` digits are known not to overflow
+	template<std::size_t Base, typename Acc>
+	constexpr std::size_t parse_digits(std::string_view str, std::size_t i, std::size_t base, Acc limit,
+		std::size_t unchecked, Acc& acc, bool& overflow) noexcept
+	{
+		if constexpr (Base != 0)
+			base = Base;
+		for (const std::size_t end = i + unchecked < str.size() ? i + unchecked : str.size(); i < end; i++) {
+			const unsigned d = Base != 0 && Base <= 10 ? static_cast<unsigned>(static_cast<unsigned char>(str[i]) - '0')
+				: parse_digit(str[i]);
+			if (d >= base)
+				return i;
+			acc = acc * base + d;
+		}
+		// acc * base + d overflows iff acc > cutoff or (acc == cutoff and d > cutlim)
+		const Acc cutoff = limit / base;
+		const auto cutlim = static_cast<unsigned>(limit % base);
+		for (; i < str.size(); i++) {
+			const unsigned d = Base != 0 && Base <= 10 ? static_cast<unsigned>(static_cast<unsigned char>(str[i]) - '0')
+				: parse_digit(str[i]);
+			if (d >= base)
+				break;
+			if (acc > cutoff || (acc == cutoff && d > cutlim))
+				overflow = true;
+			else if (!overflow)
+				acc = acc * base + d;
+		}
+		return i;
+	}
+
+	template<typename T>
+	constexpr parse_integer_result<T> parse_integer(std::string_view str, std::size_t base) noexcept {
+		static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>);
+		using U = std::make_unsigned_t<T>;
+		using Acc = std::conditional_t<(sizeof(U) > sizeof(std::uint64_t)), U, std::uint64_t>;
+
+		std::size_t i = 0;
+		bool negative = false;
+		if (i < str.size() && (str[i] == '+' || (std::is_signed_v<T> && str[i] == '-'))) {
+			negative = str[i] == '-';
+			i++;
+		}
+
+		if (base == 0) {
+			base = 10;
+			if (i + 1 < str.size() && str[i] == '0') {
+				const char p = str[i + 1];
+				if ((p == 'x' || p == 'X') && i + 2 < str.size() && parse_digit(str[i + 2]) < 16) {
+					base = 16;
+					i += 2;
+				}
+				else if ((p == 'b' || p == 'B') && i + 2 < str.size() && parse_digit(str[i + 2]) < 2) {
+					base = 2;
+					i += 2;
+				}
+				else if (parse_digit(p) < 8) {
+					base = 8;
+					i += 1;
+				}
+			}
+		}
+
+		// magnitude limit, |min| for negative values
+		const Acc limit = negative ? static_cast<Acc>(static_cast<U>(std::numeric_limits<T>::max()) + 1u)
+			: static_cast<Acc>(std::numeric_limits<T>::max());
+
+		const std::size_t digits_begin = i;
+		Acc acc = 0;
+		bool overflow = false;
+
+		if (base == 10) {
+#if USTL_LITTLE_ENDIAN
+			if (!USTL_IS_CONSTANT_EVALUATED() && sizeof(Acc) == sizeof(std::uint64_t)) {
+				std::uint64_t chunks = 0;
+				i += parse_decimal_chunks(str, i, chunks);
+				acc = static_cast<Acc>(chunks);
+				overflow = acc > limit;
+			}
+#endif
+			i = parse_digits<10>(str, i, 10, limit, i == digits_begin ? std::numeric_limits<T>::digits10 : 0, acc, overflow);
+		}
+		else
+			i = parse_digits<0>(str, i, base, limit, 0, acc, overflow);
+
+		if (i == digits_begin)
+			return { T{ 0 }, std::errc::invalid_argument, 0 };
+		if (overflow)
+			return { T{ 0 }, std::errc::result_out_of_range, i };
+
+		const U magnitude = static_cast<U>(acc);
+		const T value = negative ? static_cast<T>(U{ 0 } - magnitude) : static_cast<T>(magnitude);
+		return { value, std::errc{}, i };
+	}
+
+	template<const auto& Str, typename T>
+	constexpr T cstring_to_integer_() noexcept {
+		constexpr std::string_view str{ Str };
+		constexpr auto result = parse_integer<T>(str, 0);
+		static_assert(result.ec != std::errc::invalid_argument, "cstring_to_integer: not an integer.");
+		static_assert(result.ec != std::errc::result_out_of_range, "cstring_to_integer: integer out of range.");
+		static_assert(result.size == str.size(), "cstring_to_integer: trailing characters.");
+		return result.value;
+	}
+}
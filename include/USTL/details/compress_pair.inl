@@ -1,6 +1,7 @@
 #pragma once
 
 #include <type_traits>
+#include <utility>
 
 namespace Ubpa::USTL::details {
 	template<typename First, typename Second, bool = std::is_empty_v<First> && !std::is_final_v<First>>
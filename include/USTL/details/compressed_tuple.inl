@@ -0,0 +1,89 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// MSVC applies the empty base optimization to one base only unless asked
+#if defined(_MSC_VER)
+#define USTL_EMPTY_BASES __declspec(empty_bases)
+#else
+#define USTL_EMPTY_BASES
+#endif
+
+namespace Ubpa::USTL::details {
+	template<typename T>
+	constexpr bool is_ebo_candidate_v = std::is_empty_v<T> && !std::is_final_v<T>;
+
+	// element I, deriving from T if it is empty
+	template<std::size_t I, typename T, bool = is_ebo_candidate_v<T>>
+	class compressed_leaf : private T {
+	public:
+		constexpr compressed_leaf() noexcept(std::is_nothrow_default_constructible_v<T>) : T() {}
+
+		template<typename U>
+		constexpr compressed_leaf(std::in_place_t, U&& u) noexcept(std::is_nothrow_constructible_v<T, U>)
+			: T(std::forward<U>(u)) {}
+
+		constexpr T& get() & noexcept { return *this; }
+		constexpr const T& get() const& noexcept { return *this; }
+	};
+
+	template<std::size_t I, typename T>
+	class compressed_leaf<I, T, false> {
+	public:
+		constexpr compressed_leaf() noexcept(std::is_nothrow_default_constructible_v<T>) : value() {}
+
+		template<typename U>
+		constexpr compressed_leaf(std::in_place_t, U&& u) noexcept(std::is_nothrow_constructible_v<T, U>)
+			: value(std::forward<U>(u)) {}
+
+		constexpr T& get() & noexcept { return value; }
+		constexpr const T& get() const& noexcept { return value; }
+
+	private:
+		T value;
+	};
+
+	// storage order: empty (EBO) elements first, then by decreasing alignment, stable
+	template<typename... Ts>
+	struct compressed_tuple_order {
+		static constexpr std::size_t keys[] = { (is_ebo_candidate_v<Ts> ? ~std::size_t{ 0 } : alignof(Ts))..., 0 };
+
+		static constexpr auto value = [] {
+			std::array<std::size_t, sizeof...(Ts)> order{};
+			for (std::size_t i = 0; i < sizeof...(Ts); i++) {
+				std::size_t j = i;
+				for (; j > 0 && keys[order[j - 1]] < keys[i]; j--)
+					order[j] = order[j - 1];
+				order[j] = i;
+			}
+			return order;
+		}();
+
+		template<std::size_t... Ks>
+		static constexpr auto sequence(std::index_sequence<Ks...>) noexcept {
+			return std::index_sequence<value[Ks]...>{};
+		}
+		using type = decltype(sequence(std::index_sequence_for<Ts...>{}));
+	};
+
+	template<typename Order, typename... Ts>
+	class compressed_tuple_storage;
+
+	// bases are laid out in declaration order, i.e. in storage order
+	template<std::size_t... Order, typename... Ts>
+	class USTL_EMPTY_BASES compressed_tuple_storage<std::index_sequence<Order...>, Ts...>
+		: public compressed_leaf<Order, std::tuple_element_t<Order, std::tuple<Ts...>>>...
+	{
+	public:
+		constexpr compressed_tuple_storage() = default;
+
+		// args: std::tuple<Us&&...> in logical order
+		template<typename Args>
+		constexpr compressed_tuple_storage(std::in_place_t, Args&& args)
+			: compressed_leaf<Order, std::tuple_element_t<Order, std::tuple<Ts...>>>(std::in_place, std::get<Order>(std::move(args)))... {}
+	};
+}
@@ -1,38 +1,43 @@
 #pragma once
 
 namespace Ubpa::USTL::details {
+	// 0-9, A-F
+	constexpr char integer_digit(unsigned digit) noexcept {
+		return static_cast<char>(digit < 10 ? '0' + digit : 'A' + (digit - 10));
+	}
+
 	template<auto Num, size_t System>
-	constexpr auto cstring_integer_in_system_between_3_to_10() noexcept {
+	constexpr auto cstring_integer_in_system_between_3_to_15() noexcept {
 		using T = decltype(Num);
 		static_assert(std::is_integral_v<T>);
 		if constexpr (std::is_unsigned_v<T>) {
 			if constexpr (Num < System)
-				return cstring{ '0' + Num };
+				return cstring{ integer_digit(static_cast<unsigned>(Num)) };
 			else
-				return cstring{ cstring_integer_in_system_between_3_to_10<Num / System, System>(), cstring{ '0' + Num % System } };
+				return cstring{ cstring_integer_in_system_between_3_to_15<Num / System, System>(), cstring{ integer_digit(static_cast<unsigned>(Num % System)) } };
 		}
 		else
 		{
 			if constexpr (Num < 0) {
-				return cstring{ cstring{'-'}, cstring_integer_in_system_between_3_to_10<-Num, System>() };
+				return cstring{ cstring{'-'}, cstring_integer_in_system_between_3_to_15<-Num, System>() };
 			}
 			else {
 				if constexpr (Num < System)
-					return cstring{ '0' + Num };
+					return cstring{ integer_digit(static_cast<unsigned>(Num)) };
 				else
-					return cstring{ cstring_integer_in_system_between_3_to_10<Num / System, System>(), cstring{ '0' + Num % System } };
+					return cstring{ cstring_integer_in_system_between_3_to_15<Num / System, System>(), cstring{ integer_digit(static_cast<unsigned>(Num % System)) } };
 			}
 		}
 	}
 
 	template<auto Num>
 	constexpr auto cstring_integer_in_decimal() noexcept {
-		return cstring_integer_in_system_between_3_to_10<Num, 10>();
+		return cstring_integer_in_system_between_3_to_15<Num, 10>();
 	}
 
 	template<auto Num>
 	constexpr auto cstring_integer_in_octal() noexcept {
-		return cstring_integer_in_system_between_3_to_10<Num, 8>();
+		return cstring_integer_in_system_between_3_to_15<Num, 8>();
 	}
 
 	template<auto Num>
@@ -41,9 +46,9 @@ namespace Ubpa::USTL::details {
 		static_assert(std::is_integral_v<T>);
 		if constexpr (std::is_unsigned_v<T>) {
 			if constexpr (Num < 2)
-				return cstring{ '0' + Num };
+				return cstring{ integer_digit(static_cast<unsigned>(Num)) };
 			else
-				return cstring{ cstring_integer_in_binary<(Num >> 1)>(), cstring{ '0' + (Num & 1) } };
+				return cstring{ cstring_integer_in_binary<(Num >> 1)>(), cstring{ integer_digit(static_cast<unsigned>(Num & 1)) } };
 		}
 		else
 		{
@@ -52,9 +57,9 @@ namespace Ubpa::USTL::details {
 			}
 			else {
 				if constexpr (Num < 2)
-					return cstring{ '0' + Num };
+					return cstring{ integer_digit(static_cast<unsigned>(Num)) };
 				else
-					return cstring{ cstring_integer_in_binary<(Num >> 1)>(), cstring{ '0' + (Num & 1) } };
+					return cstring{ cstring_integer_in_binary<(Num >> 1)>(), cstring{ integer_digit(static_cast<unsigned>(Num & 1)) } };
 			}
 		}
 	}
@@ -64,10 +69,7 @@ namespace Ubpa::USTL::details {
 		using T = decltype(Num);
 		static_assert(std::is_integral_v<T>);
 		constexpr auto decimal2hex = [](auto num) {
-			if (num < 10)
-				return '0' + num;
-			else
-				return 'A' + num - 10;
+			return integer_digit(static_cast<unsigned>(num));
 		};
 		if constexpr (std::is_unsigned_v<T>) {
 			if constexpr (Num < 16)
@@ -93,11 +95,48 @@ namespace Ubpa::USTL::details {
 	constexpr auto cstring_integer_() noexcept {
 		if constexpr (System == 2)
 			return cstring_integer_in_binary<Num>();
-		else if constexpr (3 <= System && System <= 10)
-			return cstring_integer_in_system_between_3_to_10<Num, System>();
+		else if constexpr (3 <= System && System <= 15)
+			return cstring_integer_in_system_between_3_to_15<Num, System>();
 		else if constexpr (System == 16)
 			return cstring_integer_in_hex<Num>();
 		else
-			static_assert(false);
+			static_assert(2 <= System && System <= 16, "cstring_integer only supports system 2-16.");
 	}
+
+	struct cstring_segment {
+		std::size_t pos;
+		std::size_t size;
+	};
+
+	template<const auto& Str, char Delim>
+	struct cstring_split_ {
+		static constexpr std::string_view str{ Str };
+
+		static constexpr std::size_t count = [] {
+			std::size_t n = 0;
+			for (std::size_t i = 0; i < str.size(); i++)
+				n += str[i] != Delim && (i == 0 || str[i - 1] == Delim);
+			return n;
+		}();
+
+		static constexpr std::array<cstring_segment, count> segments = [] {
+			std::array<cstring_segment, count> segments{};
+			std::size_t n = 0;
+			for (std::size_t i = 0; i < str.size(); i++) {
+				if (str[i] == Delim)
+					continue;
+				if (i == 0 || str[i - 1] == Delim)
+					segments[n++].pos = i;
+				segments[n - 1].size++;
+			}
+			return segments;
+		}();
+
+		template<std::size_t... Is>
+		static constexpr auto get(std::index_sequence<Is...>) noexcept {
+			return std::tuple<cstring<segments[Is].size>...>{
+				cstring<segments[Is].size>{ str.substr(segments[Is].pos, segments[Is].size) }...
+			};
+		}
+	};
 }
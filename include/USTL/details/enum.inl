@@ -0,0 +1,143 @@
+#pragma once
+
+#include <array>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace Ubpa::USTL::details {
+	template<auto V>
+	constexpr std::string_view raw_enum_name() noexcept {
+#if defined(__clang__) || defined(__GNUC__)
+		return __PRETTY_FUNCTION__;
+#elif defined(_MSC_VER)
+		return __FUNCSIG__;
+#else
+		static_assert(sizeof(V) == 0, "enum_name requires __PRETTY_FUNCTION__ or __FUNCSIG__.");
+#endif
+	}
+
+	enum class enum_probe { probe };
+
+	// the probe value locates where V is printed inside raw_enum_name
+	constexpr std::string_view enum_probe_name = "Ubpa::USTL::details::enum_probe::probe";
+	constexpr std::size_t enum_name_prefix = raw_enum_name<enum_probe::probe>().find(enum_probe_name);
+	constexpr std::size_t enum_name_suffix = raw_enum_name<enum_probe::probe>().size() - enum_name_prefix - enum_probe_name.size();
+
+	// empty if V is not a named enumerator, compilers print those as a cast, e.g. "(E)5"
+	template<auto V>
+	constexpr std::string_view enum_name_of() noexcept {
+		constexpr std::string_view raw = raw_enum_name<V>();
+		constexpr std::string_view str = raw.substr(enum_name_prefix, raw.size() - enum_name_prefix - enum_name_suffix);
+		if constexpr (str.empty() || !is_identifier_char(str.front()) || ('0' <= str.front() && str.front() <= '9'))
+			return {};
+		else {
+			constexpr std::size_t colon = str.rfind(':');
+			return colon == std::string_view::npos ? str : str.substr(colon + 1);
+		}
+	}
+
+	template<auto V>
+	constexpr auto enum_name_() noexcept {
+		static_assert(std::is_enum_v<decltype(V)>);
+		constexpr std::string_view name = enum_name_of<V>();
+		static_assert(!name.empty(), "enum_name requires a named enumerator.");
+		return cstring<name.size()>{ name };
+	}
+
+	template<typename E>
+	constexpr std::size_t enum_range_size() noexcept {
+		return static_cast<std::size_t>(enum_range<E>::max - enum_range<E>::min + 1);
+	}
+
+	template<typename E>
+	constexpr E enum_at(std::size_t i) noexcept {
+		return static_cast<E>(static_cast<long long>(enum_range<E>::min) + static_cast<long long>(i));
+	}
+
+	// [dense table]
+	// one entry per probed value, empty if not a named enumerator
+	template<typename E, std::size_t... Is>
+	constexpr std::array<std::string_view, sizeof...(Is)> enum_dense_names_(std::index_sequence<Is...>) noexcept {
+		return { enum_name_of<enum_at<E>(Is)>()... };
+	}
+
+	template<typename E>
+	constexpr auto enum_dense_names = enum_dense_names_<E>(std::make_index_sequence<enum_range_size<E>()>{});
+
+	template<typename E>
+	constexpr std::size_t enum_count_() noexcept {
+		std::size_t n = 0;
+		for (const auto& name : enum_dense_names<E>)
+			n += !name.empty();
+		return n;
+	}
+
+	template<typename E>
+	constexpr auto enum_values_() noexcept {
+		std::array<E, enum_count_<E>()> values{};
+		std::size_t n = 0;
+		for (std::size_t i = 0; i < enum_dense_names<E>.size(); i++) {
+			if (!enum_dense_names<E>[i].empty())
+				values[n++] = enum_at<E>(i);
+		}
+		return values;
+	}
+
+	template<typename E>
+	constexpr auto enum_names_() noexcept {
+		std::array<std::string_view, enum_count_<E>()> names{};
+		std::size_t n = 0;
+		for (const auto& name : enum_dense_names<E>) {
+			if (!name.empty())
+				names[n++] = name;
+		}
+		return names;
+	}
+
+	// [perfect hash]
+	// slot = hash(name, seed) & (slots - 1), seed searched at compile time
+
+	constexpr std::uint64_t enum_hash(std::string_view str, std::uint64_t seed) noexcept {
+		std::uint64_t hash = 14695981039346656037ull ^ (seed * 0x9E3779B97F4A7C15ull);
+		for (const auto c : str) {
+			hash ^= static_cast<unsigned char>(c);
+			hash *= 1099511628211ull;
+		}
+		return hash ^ (hash >> 32);
+	}
+
+	template<std::size_t Slots>
+	struct enum_hash_table {
+		std::uint64_t seed;
+		std::array<std::uint16_t, Slots> slots; // index into enum_values + 1, 0 for empty
+	};
+
+	template<typename E>
+	constexpr std::size_t enum_hash_slots() noexcept {
+		std::size_t n = 1;
+		while (n < 2 * enum_count_<E>())
+			n *= 2;
+		return n;
+	}
+
+	template<typename E>
+	constexpr auto enum_hash_table_() noexcept {
+		constexpr auto names = enum_names_<E>();
+		constexpr std::size_t Slots = enum_hash_slots<E>();
+		enum_hash_table<Slots> table{};
+		for (std::uint64_t seed = 0;; seed++) {
+			table.seed = seed;
+			table.slots = {};
+			bool collide = false;
+			for (std::size_t i = 0; i < names.size() && !collide; i++) {
+				auto& slot = table.slots[enum_hash(names[i], seed) & (Slots - 1)];
+				collide = slot != 0;
+				slot = static_cast<std::uint16_t>(i + 1);
+			}
+			if (!collide)
+				return table;
+		}
+	}
+}
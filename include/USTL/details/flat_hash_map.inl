@@ -0,0 +1,823 @@
+#pragma once
+
+#include "../compress_pair.h"
+
+#include "hash_mix.inl"
+#include "simd.inl"
+#include "small_vector.inl"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace Ubpa::USTL::details {
+	// [control bytes]
+	// one byte per slot: empty / deleted have the sign bit set, a full slot keeps 7 bits of the hash (h2)
+	// ctrl[capacity] is the sentinel that stops iteration, the bytes after it pad the last group load
+
+	using flat_ctrl_t = std::int8_t;
+	inline constexpr flat_ctrl_t flat_ctrl_empty = -128;
+	inline constexpr flat_ctrl_t flat_ctrl_deleted = -2;
+	inline constexpr flat_ctrl_t flat_ctrl_sentinel = -1;
+
+	inline constexpr std::size_t flat_group_width = 16;
+
+	// the user hash may be the identity (pointers, integers), so it is mixed before the split
+	inline std::size_t flat_hash_mix(std::size_t hash) noexcept {
+		return static_cast<std::size_t>(hash_mum(static_cast<std::uint64_t>(hash) ^ hash_k0, hash_k1));
+	}
+
+	inline std::size_t flat_h1(std::size_t hash) noexcept { return hash >> 7; }
+	inline flat_ctrl_t flat_h2(std::size_t hash) noexcept { return static_cast<flat_ctrl_t>(hash & 0x7F); }
+
+	// 16 control bytes, a match is a bitmask with bit i for byte i
+	class flat_group {
+	public:
+		explicit flat_group(const flat_ctrl_t* ctrl) noexcept {
+#if USTL_SSE2
+			ctrl_ = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+#else
+			std::memcpy(ctrl_, ctrl, flat_group_width);
+#endif
+		}
+
+		std::uint32_t match(flat_ctrl_t h2) const noexcept {
+#if USTL_SSE2
+			return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl_, _mm_set1_epi8(h2))));
+#else
+			std::uint32_t mask = 0;
+			for (std::size_t i = 0; i < flat_group_width; i++)
+				mask |= static_cast<std::uint32_t>(ctrl_[i] == h2) << i;
+			return mask;
+#endif
+		}
+
+		std::uint32_t match_empty() const noexcept { return match(flat_ctrl_empty); }
+
+		std::uint32_t match_empty_or_deleted() const noexcept {
+#if USTL_SSE2
+			return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(flat_ctrl_sentinel), ctrl_)));
+#else
+			std::uint32_t mask = 0;
+			for (std::size_t i = 0; i < flat_group_width; i++)
+				mask |= static_cast<std::uint32_t>(ctrl_[i] < flat_ctrl_sentinel) << i;
+			return mask;
+#endif
+		}
+
+		// empty or deleted bytes before the first full one or the sentinel
+		unsigned count_leading_empty_or_deleted() const noexcept {
+			return countr_zero(~match_empty_or_deleted());
+		}
+
+	private:
+#if USTL_SSE2
+		__m128i ctrl_;
+#else
+		flat_ctrl_t ctrl_[flat_group_width];
+#endif
+	};
+
+	// triangular steps over the groups, each one is visited once since the group count is a power of two
+	class flat_probe_seq {
+	public:
+		flat_probe_seq(std::size_t hash, std::size_t group_mask) noexcept
+			: mask_{ group_mask }, group_{ flat_h1(hash) & group_mask } {}
+
+		std::size_t offset() const noexcept { return group_ * flat_group_width; }
+
+		void next() noexcept {
+			index_++;
+			group_ = (group_ + index_) & mask_;
+		}
+
+	private:
+		std::size_t mask_;
+		std::size_t group_;
+		std::size_t index_{ 0 };
+	};
+
+	// [policies]
+	// slot_type is what the table allocates, element(slot) the value_type living in it,
+	// mutable_element(slot) the same object with a movable key;
+	// transfer moves an element to an uninitialized slot and destroys the source
+
+	template<typename Key, typename T>
+	struct flat_map_policy {
+		using key_type = Key;
+		using value_type = std::pair<const Key, T>;
+
+		// value is the one constructed, mutable_value lets a rehash move the key (same layout)
+		union slot_type {
+			slot_type() noexcept {}
+			~slot_type() {}
+			value_type value;
+			std::pair<Key, T> mutable_value;
+		};
+
+		static const Key& key(const value_type& value) noexcept { return value.first; }
+		static value_type& element(slot_type* slot) noexcept { return slot->value; }
+		static std::pair<Key, T>& mutable_element(slot_type* slot) noexcept { return slot->mutable_value; }
+
+		template<typename Alloc>
+		static void transfer(Alloc& alloc, slot_type* dst, slot_type* src) {
+			std::allocator_traits<Alloc>::construct(alloc, &dst->mutable_value, std::move(src->mutable_value));
+			std::allocator_traits<Alloc>::destroy(alloc, &src->mutable_value);
+		}
+
+		// emplace(key, mapped) and emplace(pair) name the key, no element is built for the lookup
+		template<typename... Args>
+		struct key_arg : std::false_type {};
+		template<typename K, typename V>
+		struct key_arg<K, V> : std::is_same<std::remove_cv_t<std::remove_reference_t<K>>, Key> {};
+		template<typename P>
+		struct key_arg<P> : std::false_type {};
+		template<typename K, typename V>
+		struct key_arg<std::pair<K, V>> : std::is_same<std::remove_cv_t<K>, Key> {};
+		template<typename K, typename V>
+		struct key_arg<std::pair<K, V>&> : std::is_same<std::remove_cv_t<K>, Key> {};
+		template<typename K, typename V>
+		struct key_arg<const std::pair<K, V>&> : std::is_same<std::remove_cv_t<K>, Key> {};
+
+		template<typename K, typename V>
+		static const Key& key_of_args(const K& key, const V&) noexcept { return key; }
+		template<typename K, typename V>
+		static const Key& key_of_args(const std::pair<K, V>& pair) noexcept { return pair.first; }
+	};
+
+	template<typename Key>
+	struct flat_set_policy {
+		using key_type = Key;
+		using value_type = Key;
+		using slot_type = Key;
+
+		static const Key& key(const value_type& value) noexcept { return value; }
+		static value_type& element(slot_type* slot) noexcept { return *slot; }
+		static Key& mutable_element(slot_type* slot) noexcept { return *slot; }
+
+		template<typename Alloc>
+		static void transfer(Alloc& alloc, slot_type* dst, slot_type* src) {
+			std::allocator_traits<Alloc>::construct(alloc, dst, std::move(*src));
+			std::allocator_traits<Alloc>::destroy(alloc, src);
+		}
+
+		template<typename... Args>
+		struct key_arg : std::false_type {};
+		template<typename K>
+		struct key_arg<K> : std::is_same<std::remove_cv_t<std::remove_reference_t<K>>, Key> {};
+
+		static const Key& key_of_args(const Key& key) noexcept { return key; }
+	};
+
+	template<typename Hash, typename KeyEqual, typename = void>
+	struct flat_is_transparent : std::false_type {};
+	template<typename Hash, typename KeyEqual>
+	struct flat_is_transparent<Hash, KeyEqual, std::void_t<typename Hash::is_transparent, typename KeyEqual::is_transparent>>
+		: std::true_type {};
+
+	// an element built outside the table, destroyed unless it was transferred into a slot
+	template<typename Policy, typename Alloc>
+	class flat_temp_slot {
+		using slot_type = typename Policy::slot_type;
+	public:
+		template<typename... Args>
+		flat_temp_slot(Alloc& alloc, Args&&... args) : alloc_{ alloc } {
+			std::allocator_traits<Alloc>::construct(alloc_, &Policy::element(slot()), std::forward<Args>(args)...);
+		}
+		flat_temp_slot(const flat_temp_slot&) = delete;
+		flat_temp_slot& operator=(const flat_temp_slot&) = delete;
+		~flat_temp_slot() {
+			if (!released_)
+				std::allocator_traits<Alloc>::destroy(alloc_, &Policy::element(slot()));
+		}
+
+		slot_type* slot() noexcept { return reinterpret_cast<slot_type*>(buffer_); }
+
+		void transfer_to(slot_type* dst) {
+			Policy::transfer(alloc_, dst, slot());
+			released_ = true;
+		}
+
+	private:
+		Alloc& alloc_;
+		bool released_{ false };
+		alignas(slot_type) unsigned char buffer_[sizeof(slot_type)];
+	};
+
+	template<typename Policy, typename Hash, typename KeyEqual, typename Alloc>
+	class flat_hash_table;
+
+	template<typename Policy, bool Const>
+	class flat_hash_iterator {
+		using slot_type = typename Policy::slot_type;
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = typename Policy::value_type;
+		using difference_type = std::ptrdiff_t;
+		using reference = std::conditional_t<Const, const value_type&, value_type&>;
+		using pointer = std::conditional_t<Const, const value_type*, value_type*>;
+
+		flat_hash_iterator() noexcept = default;
+
+		template<bool C = Const, std::enable_if_t<C, int> = 0>
+		flat_hash_iterator(const flat_hash_iterator<Policy, false>& other) noexcept
+			: ctrl_{ other.ctrl_ }, slot_{ other.slot_ } {}
+
+		reference operator*() const noexcept { return Policy::element(slot_); }
+		pointer operator->() const noexcept { return std::addressof(Policy::element(slot_)); }
+
+		flat_hash_iterator& operator++() noexcept {
+			++ctrl_;
+			++slot_;
+			skip_empty_or_deleted();
+			return *this;
+		}
+
+		flat_hash_iterator operator++(int) noexcept {
+			flat_hash_iterator rst = *this;
+			++*this;
+			return rst;
+		}
+
+		friend bool operator==(const flat_hash_iterator& lhs, const flat_hash_iterator& rhs) noexcept {
+			return lhs.ctrl_ == rhs.ctrl_;
+		}
+
+		friend bool operator!=(const flat_hash_iterator& lhs, const flat_hash_iterator& rhs) noexcept {
+			return lhs.ctrl_ != rhs.ctrl_;
+		}
+
+	private:
+		template<typename, bool>
+		friend class flat_hash_iterator;
+		template<typename, typename, typename, typename>
+		friend class flat_hash_table;
+
+		flat_hash_iterator(const flat_ctrl_t* ctrl, slot_type* slot) noexcept : ctrl_{ ctrl }, slot_{ slot } {}
+
+		// stops at a full slot or the sentinel, a group at a time
+		void skip_empty_or_deleted() noexcept {
+			while (*ctrl_ < flat_ctrl_sentinel) {
+				const unsigned shift = flat_group{ ctrl_ }.count_leading_empty_or_deleted();
+				ctrl_ += shift;
+				slot_ += shift;
+			}
+		}
+
+		const flat_ctrl_t* ctrl_{ nullptr };
+		slot_type* slot_{ nullptr };
+	};
+
+	// open addressing over 16-slot groups (Swiss table), shared by flat_hash_map and flat_hash_set
+	// - capacity is 0 or a power of two >= flat_group_width, at most 7/8 of it is used
+	// - erase leaves a deleted mark unless the group still has an empty slot (no probe went past it)
+	// - hasher, key_equal and allocator take no space when they are empty (compress_pair)
+	template<typename Policy, typename Hash, typename KeyEqual, typename Alloc>
+	class flat_hash_table {
+		using slot_type = typename Policy::slot_type;
+		using traits = std::allocator_traits<Alloc>;
+		using slot_alloc_type = typename traits::template rebind_alloc<slot_type>;
+		using slot_traits = std::allocator_traits<slot_alloc_type>;
+		using ctrl_alloc_type = typename traits::template rebind_alloc<flat_ctrl_t>;
+		using ctrl_traits = std::allocator_traits<ctrl_alloc_type>;
+		using hash_alloc_type = typename traits::template rebind_alloc<std::size_t>;
+		using hash_traits = std::allocator_traits<hash_alloc_type>;
+		static constexpr bool is_set = std::is_same_v<typename Policy::key_type, typename Policy::value_type>;
+		static constexpr bool transparent_lookup = flat_is_transparent<Hash, KeyEqual>::value;
+		static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+		using mutable_value_type = std::remove_reference_t<decltype(Policy::mutable_element(std::declval<slot_type*>()))>;
+		// a rehash copies when moving may throw, unless the element cannot be copied
+		static constexpr bool strong_rehash = std::is_nothrow_move_constructible_v<mutable_value_type>
+			|| std::is_copy_constructible_v<mutable_value_type>;
+		static constexpr bool nothrow_hash = std::is_nothrow_invocable_v<const Hash&, const typename Policy::key_type&>;
+	public:
+		using key_type = typename Policy::key_type;
+		using value_type = typename Policy::value_type;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using hasher = Hash;
+		using key_equal = KeyEqual;
+		using allocator_type = Alloc;
+		using reference = value_type&;
+		using const_reference = const value_type&;
+		using pointer = typename traits::pointer;
+		using const_pointer = typename traits::const_pointer;
+		using iterator = flat_hash_iterator<Policy, is_set>; // the keys of a set are not mutable
+		using const_iterator = flat_hash_iterator<Policy, true>;
+
+		static_assert(std::is_same_v<value_type, typename traits::value_type>);
+
+		flat_hash_table() noexcept(std::is_nothrow_default_constructible_v<Hash>
+			&& std::is_nothrow_default_constructible_v<KeyEqual> && std::is_nothrow_default_constructible_v<Alloc>) = default;
+
+		explicit flat_hash_table(size_type bucket_count, const Hash& hash = Hash{}, const KeyEqual& equal = KeyEqual{},
+			const Alloc& alloc = Alloc{})
+			: storage_{ one_then_variadic_args_t{}, hash, one_then_variadic_args_t{}, equal, one_then_variadic_args_t{}, alloc }
+		{
+			if (bucket_count != 0)
+				rehash(bucket_count);
+		}
+
+		explicit flat_hash_table(const Alloc& alloc) : flat_hash_table{ 0, Hash{}, KeyEqual{}, alloc } {}
+
+		template<typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+		flat_hash_table(InputIt first, InputIt last, size_type bucket_count = 0, const Hash& hash = Hash{},
+			const KeyEqual& equal = KeyEqual{}, const Alloc& alloc = Alloc{})
+			: flat_hash_table{ bucket_count, hash, equal, alloc }
+		{
+			insert(first, last);
+		}
+
+		flat_hash_table(std::initializer_list<value_type> ilist, size_type bucket_count = 0, const Hash& hash = Hash{},
+			const KeyEqual& equal = KeyEqual{}, const Alloc& alloc = Alloc{})
+			: flat_hash_table{ ilist.begin(), ilist.end(), bucket_count, hash, equal, alloc } {}
+
+		flat_hash_table(const flat_hash_table& other)
+			: flat_hash_table{ 0, other.hash_ref(), other.equal_ref(),
+				traits::select_on_container_copy_construction(other.alloc_ref()) }
+		{
+			copy_elements(other);
+		}
+
+		flat_hash_table(flat_hash_table&& other) noexcept
+			: flat_hash_table{ 0, other.hash_ref(), other.equal_ref(), std::move(other.alloc_ref()) }
+		{
+			data() = std::exchange(other.data(), table_data{});
+		}
+
+		flat_hash_table& operator=(const flat_hash_table& rhs) {
+			if (this == &rhs)
+				return *this;
+			clear();
+			hash_ref() = rhs.hash_ref();
+			equal_ref() = rhs.equal_ref();
+			if constexpr (traits::propagate_on_container_copy_assignment::value) {
+				if (alloc_ref() != rhs.alloc_ref())
+					release();
+				alloc_ref() = rhs.alloc_ref();
+			}
+			copy_elements(rhs);
+			return *this;
+		}
+
+		flat_hash_table& operator=(flat_hash_table&& rhs) noexcept(
+			traits::propagate_on_container_move_assignment::value || traits::is_always_equal::value)
+		{
+			if (this == &rhs)
+				return *this;
+			clear();
+			hash_ref() = rhs.hash_ref();
+			equal_ref() = rhs.equal_ref();
+			if constexpr (traits::propagate_on_container_move_assignment::value) {
+				release();
+				alloc_ref() = std::move(rhs.alloc_ref());
+			}
+			if (traits::propagate_on_container_move_assignment::value || traits::is_always_equal::value
+				|| alloc_ref() == rhs.alloc_ref())
+			{
+				release();
+				data() = std::exchange(rhs.data(), table_data{});
+			}
+			else {
+				// rhs keeps its (moved-from) elements until all of them are moved, so a throw leaks nothing
+				reserve(rhs.size());
+				for_each_full(rhs.data(), [&](size_type i) {
+					const size_type hash = rhs.hash_at(i);
+					const size_type j = find_insert_index(hash);
+					traits::construct(alloc_ref(), &Policy::mutable_element(data().slots + j),
+						std::move(Policy::mutable_element(rhs.data().slots + i)));
+					set_full(j, hash);
+				});
+				rhs.clear();
+			}
+			return *this;
+		}
+
+		~flat_hash_table() {
+			destroy_elements(data());
+			release();
+		}
+
+		allocator_type get_allocator() const { return alloc_ref(); }
+		hasher hash_function() const { return hash_ref(); }
+		key_equal key_eq() const { return equal_ref(); }
+
+		iterator begin() noexcept {
+			if (data().size == 0)
+				return end();
+			iterator it{ data().ctrl, data().slots };
+			it.skip_empty_or_deleted();
+			return it;
+		}
+		const_iterator begin() const noexcept { return const_cast<flat_hash_table&>(*this).begin(); }
+		const_iterator cbegin() const noexcept { return begin(); }
+		iterator end() noexcept { return iterator_at(data().capacity); }
+		const_iterator end() const noexcept { return const_cast<flat_hash_table&>(*this).end(); }
+		const_iterator cend() const noexcept { return end(); }
+
+		bool empty() const noexcept { return data().size == 0; }
+		size_type size() const noexcept { return data().size; }
+		size_type max_size() const noexcept { return slot_traits::max_size(slot_alloc_type{ alloc_ref() }); }
+		size_type capacity() const noexcept { return data().capacity; }
+		size_type bucket_count() const noexcept { return data().capacity; }
+		float load_factor() const noexcept {
+			return data().capacity == 0 ? 0.f : static_cast<float>(data().size) / static_cast<float>(data().capacity);
+		}
+		float max_load_factor() const noexcept { return 0.875f; }
+
+		// keeps the storage
+		void clear() noexcept {
+			destroy_elements(data());
+			data().size = 0;
+			reset_ctrl();
+		}
+
+		std::pair<iterator, bool> insert(const value_type& value) { return emplace(value); }
+		std::pair<iterator, bool> insert(value_type&& value) { return emplace(std::move(value)); }
+		iterator insert(const_iterator, const value_type& value) { return emplace(value).first; }
+		iterator insert(const_iterator, value_type&& value) { return emplace(std::move(value)).first; }
+
+		template<typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+		void insert(InputIt first, InputIt last) {
+			for (; first != last; ++first)
+				emplace(*first);
+		}
+
+		void insert(std::initializer_list<value_type> ilist) { insert(ilist.begin(), ilist.end()); }
+
+		template<typename... Args>
+		std::pair<iterator, bool> emplace(Args&&... args) {
+			if constexpr (Policy::template key_arg<Args...>::value)
+				return emplace_key(Policy::key_of_args(args...), std::forward<Args>(args)...);
+			else {
+				flat_temp_slot<Policy, Alloc> tmp{ alloc_ref(), std::forward<Args>(args)... };
+				const key_type& key = Policy::key(Policy::element(tmp.slot()));
+				const size_type hash = hash_of(key);
+				if (const size_type i = find_index(key, hash); i != npos)
+					return { iterator_at(i), false };
+				return { iterator_at(insert_transfer(hash, tmp)), true };
+			}
+		}
+
+		template<typename... Args>
+		iterator emplace_hint(const_iterator, Args&&... args) { return emplace(std::forward<Args>(args)...).first; }
+
+		// returns the iterator following pos
+		iterator erase(const_iterator pos) noexcept {
+			const size_type i = index_of(pos);
+			erase_at(i);
+			iterator it = iterator_at(i);
+			it.skip_empty_or_deleted();
+			return it;
+		}
+
+		iterator erase(const_iterator first, const_iterator last) noexcept {
+			while (first != last)
+				first = erase(first);
+			return iterator_at(index_of(last));
+		}
+
+		size_type erase(const key_type& key) {
+			const size_type i = find_index(key, hash_of(key));
+			if (i == npos)
+				return 0;
+			erase_at(i);
+			return 1;
+		}
+
+		void swap(flat_hash_table& other) noexcept(std::is_nothrow_swappable_v<Hash> && std::is_nothrow_swappable_v<KeyEqual>
+			&& (traits::propagate_on_container_swap::value || traits::is_always_equal::value))
+		{
+			using std::swap;
+			swap(hash_ref(), other.hash_ref());
+			swap(equal_ref(), other.equal_ref());
+			if constexpr (traits::propagate_on_container_swap::value)
+				swap(alloc_ref(), other.alloc_ref());
+			else
+				assert(alloc_ref() == other.alloc_ref());
+			swap(data(), other.data());
+		}
+
+		iterator find(const key_type& key) { return find_iterator(key); }
+		const_iterator find(const key_type& key) const { return const_cast<flat_hash_table&>(*this).find_iterator(key); }
+		bool contains(const key_type& key) const { return find_index(key, hash_of(key)) != npos; }
+		size_type count(const key_type& key) const { return contains(key) ? 1 : 0; }
+
+		// heterogeneous lookup, the hasher and key_equal both declare is_transparent
+		template<typename K, bool T = transparent_lookup, std::enable_if_t<T, int> = 0>
+		iterator find(const K& key) { return find_iterator(key); }
+		template<typename K, bool T = transparent_lookup, std::enable_if_t<T, int> = 0>
+		const_iterator find(const K& key) const { return const_cast<flat_hash_table&>(*this).find_iterator(key); }
+		template<typename K, bool T = transparent_lookup, std::enable_if_t<T, int> = 0>
+		bool contains(const K& key) const { return find_index(key, hash_of(key)) != npos; }
+		template<typename K, bool T = transparent_lookup, std::enable_if_t<T, int> = 0>
+		size_type count(const K& key) const { return contains(key) ? 1 : 0; }
+
+		// room for count elements without a rehash
+		void reserve(size_type count) {
+			if (count > data().size + data().growth_left)
+				resize(capacity_for(count));
+		}
+
+		// at least count slots, also drops the deleted marks; count == 0 on an empty table frees the storage
+		void rehash(size_type count) {
+			if (count == 0 && data().size == 0) {
+				release();
+				return;
+			}
+			size_type capacity = capacity_for(data().size);
+			while (capacity < count)
+				capacity *= 2;
+			resize(capacity);
+		}
+
+	protected:
+		// the key is only read before the element is built, so it may be a part of args
+		template<typename K, typename... Args>
+		std::pair<iterator, bool> emplace_key(const K& key, Args&&... args) {
+			const size_type hash = hash_of(key);
+			if (const size_type i = find_index(key, hash); i != npos)
+				return { iterator_at(i), false };
+			if (data().growth_left == 0) {
+				// args may refer to elements, build the new one before the rehash moves them
+				flat_temp_slot<Policy, Alloc> tmp{ alloc_ref(), std::forward<Args>(args)... };
+				return { iterator_at(insert_transfer(hash, tmp)), true };
+			}
+			const size_type i = find_insert_index(hash);
+			traits::construct(alloc_ref(), &Policy::element(data().slots + i), std::forward<Args>(args)...);
+			set_full(i, hash);
+			return { iterator_at(i), true };
+		}
+
+		template<typename K>
+		iterator find_iterator(const K& key) {
+			const size_type i = find_index(key, hash_of(key));
+			return i == npos ? end() : iterator_at(i);
+		}
+
+	private:
+		struct table_data {
+			flat_ctrl_t* ctrl{ nullptr };
+			slot_type* slots{ nullptr };
+			size_type capacity{ 0 };
+			size_type size{ 0 };
+			size_type growth_left{ 0 }; // inserts into empty slots before the next rehash
+		};
+
+		Hash& hash_ref() noexcept { return storage_.get_first(); }
+		const Hash& hash_ref() const noexcept { return storage_.get_first(); }
+		KeyEqual& equal_ref() noexcept { return storage_.get_second().get_first(); }
+		const KeyEqual& equal_ref() const noexcept { return storage_.get_second().get_first(); }
+		Alloc& alloc_ref() noexcept { return storage_.get_second().get_second().get_first(); }
+		const Alloc& alloc_ref() const noexcept { return storage_.get_second().get_second().get_first(); }
+		table_data& data() noexcept { return storage_.get_second().get_second().get_second(); }
+		const table_data& data() const noexcept { return storage_.get_second().get_second().get_second(); }
+
+		static size_type capacity_for(size_type count) noexcept {
+			size_type capacity = flat_group_width;
+			while (capacity - capacity / 8 < count)
+				capacity *= 2;
+			return capacity;
+		}
+
+		template<typename K>
+		size_type hash_of(const K& key) const {
+			return flat_hash_mix(static_cast<std::size_t>(hash_ref()(key)));
+		}
+
+		size_type hash_at(size_type i) const {
+			return hash_of(Policy::key(Policy::element(data().slots + i)));
+		}
+
+		iterator iterator_at(size_type i) noexcept { return { data().ctrl + i, data().slots + i }; }
+
+		size_type index_of(const_iterator pos) const noexcept {
+			return static_cast<size_type>(pos.ctrl_ - data().ctrl);
+		}
+
+		template<typename K>
+		size_type find_index(const K& key, size_type hash) const {
+			const table_data& d = data();
+			if (d.capacity == 0)
+				return npos;
+			const flat_ctrl_t h2 = flat_h2(hash);
+			for (flat_probe_seq seq{ hash, d.capacity / flat_group_width - 1 };; seq.next()) {
+				const flat_group group{ d.ctrl + seq.offset() };
+				for (std::uint32_t mask = group.match(h2); mask != 0; mask &= mask - 1) {
+					const size_type i = seq.offset() + countr_zero(mask);
+					if (equal_ref()(Policy::key(Policy::element(d.slots + i)), key))
+						return i;
+				}
+				if (group.match_empty() != 0)
+					return npos;
+			}
+		}
+
+		// the first empty or deleted slot on the probe sequence, growth_left > 0 or a deleted one exists
+		size_type find_insert_index(size_type hash) const noexcept {
+			const table_data& d = data();
+			for (flat_probe_seq seq{ hash, d.capacity / flat_group_width - 1 };; seq.next()) {
+				const std::uint32_t mask = flat_group{ d.ctrl + seq.offset() }.match_empty_or_deleted();
+				if (mask != 0)
+					return seq.offset() + countr_zero(mask);
+			}
+		}
+
+		void set_full(size_type i, size_type hash) noexcept {
+			table_data& d = data();
+			if (d.ctrl[i] == flat_ctrl_empty)
+				d.growth_left--;
+			d.ctrl[i] = flat_h2(hash);
+			d.size++;
+		}
+
+		size_type insert_transfer(size_type hash, flat_temp_slot<Policy, Alloc>& tmp) {
+			if (data().growth_left == 0)
+				grow();
+			const size_type i = find_insert_index(hash);
+			tmp.transfer_to(data().slots + i);
+			set_full(i, hash);
+			return i;
+		}
+
+		// a rehash in place if deleted marks took most of the room, doubles otherwise
+		void grow() {
+			const table_data& d = data();
+			if (d.capacity != 0 && d.size < (d.capacity - d.capacity / 8) / 2)
+				resize(d.capacity);
+			else
+				resize(std::max(d.capacity * 2, flat_group_width));
+		}
+
+		// moves the elements to new storage of the given capacity (copies them if moving may throw);
+		// a hasher that may throw sees every element first, so its throw leaves the table unchanged
+		void resize(size_type capacity) {
+			assert(capacity >= flat_group_width && (capacity & (capacity - 1)) == 0);
+			assert(capacity - capacity / 8 >= data().size);
+			const table_data old = data();
+			if constexpr (nothrow_hash)
+				transfer_to(capacity, [&](size_type i) { return hash_of(Policy::key(Policy::element(old.slots + i))); });
+			else {
+				if (old.size == 0) {
+					transfer_to(capacity, [](size_type) -> size_type { return 0; });
+					return;
+				}
+				hash_alloc_type hash_alloc{ alloc_ref() };
+				size_type* hashes = hash_traits::allocate(hash_alloc, old.size);
+				try {
+					size_type n = 0;
+					for_each_full(old, [&](size_type i) { hashes[n++] = hash_of(Policy::key(Policy::element(old.slots + i))); });
+					n = 0;
+					transfer_to(capacity, [&](size_type) { return hashes[n++]; });
+				}
+				catch (...) {
+					hash_traits::deallocate(hash_alloc, hashes, old.size);
+					throw;
+				}
+				hash_traits::deallocate(hash_alloc, hashes, old.size);
+			}
+		}
+
+		// the resize itself, hash_of_slot(i) is called once per full slot i in order and must not throw;
+		// if a copy throws, the old storage is kept as it was (strong_rehash), otherwise the elements
+		// not moved yet are destroyed with it (basic guarantee)
+		template<typename HashOfSlot>
+		void transfer_to(size_type capacity, HashOfSlot&& hash_of_slot) {
+			const table_data old = data();
+			allocate(capacity);
+			try {
+				for_each_full(old, [&](size_type i) {
+					slot_type* src = old.slots + i;
+					const size_type hash = hash_of_slot(i);
+					const size_type j = find_insert_index(hash);
+					traits::construct(alloc_ref(), &Policy::mutable_element(data().slots + j),
+						std::move_if_noexcept(Policy::mutable_element(src)));
+					set_full(j, hash);
+				});
+			}
+			catch (...) {
+				if constexpr (strong_rehash) {
+					destroy_elements(data());
+					deallocate(data());
+					data() = old;
+				}
+				else {
+					destroy_elements(old);
+					deallocate(old);
+				}
+				throw;
+			}
+			destroy_elements(old);
+			deallocate(old);
+		}
+
+		// empty storage, the elements stay in the previous one
+		void allocate(size_type capacity) {
+			ctrl_alloc_type ctrl_alloc{ alloc_ref() };
+			slot_alloc_type slot_alloc{ alloc_ref() };
+			flat_ctrl_t* ctrl = ctrl_traits::allocate(ctrl_alloc, capacity + flat_group_width);
+			slot_type* slots;
+			try {
+				slots = slot_traits::allocate(slot_alloc, capacity);
+			}
+			catch (...) {
+				ctrl_traits::deallocate(ctrl_alloc, ctrl, capacity + flat_group_width);
+				throw;
+			}
+			data() = { ctrl, slots, capacity, 0, 0 };
+			reset_ctrl();
+		}
+
+		void deallocate(const table_data& d) noexcept {
+			if (d.capacity == 0)
+				return;
+			ctrl_alloc_type ctrl_alloc{ alloc_ref() };
+			slot_alloc_type slot_alloc{ alloc_ref() };
+			ctrl_traits::deallocate(ctrl_alloc, d.ctrl, d.capacity + flat_group_width);
+			slot_traits::deallocate(slot_alloc, d.slots, d.capacity);
+		}
+
+		// the elements must be destroyed
+		void release() noexcept {
+			deallocate(data());
+			data() = table_data{};
+		}
+
+		// all slots empty, the sentinel and the padding after it
+		void reset_ctrl() noexcept {
+			table_data& d = data();
+			if (d.capacity == 0)
+				return;
+			std::memset(d.ctrl, flat_ctrl_empty, d.capacity);
+			std::memset(d.ctrl + d.capacity, flat_ctrl_sentinel, flat_group_width);
+			d.growth_left = d.capacity - d.capacity / 8 - d.size;
+		}
+
+		template<typename Func>
+		static void for_each_full(const table_data& d, Func&& func) {
+			if (d.size == 0)
+				return;
+			for (size_type i = 0; i < d.capacity; i++) {
+				if (d.ctrl[i] >= 0)
+					func(i);
+			}
+		}
+
+		void destroy_elements(const table_data& d) noexcept {
+			if constexpr (!std::is_trivially_destructible_v<value_type> || !alloc_is_default_construct_v<Alloc, value_type>)
+				for_each_full(d, [&](size_type i) { traits::destroy(alloc_ref(), &Policy::element(d.slots + i)); });
+		}
+
+		void erase_at(size_type i) noexcept {
+			table_data& d = data();
+			assert(d.ctrl[i] >= 0);
+			traits::destroy(alloc_ref(), &Policy::element(d.slots + i));
+			d.size--;
+			if (flat_group{ d.ctrl + i / flat_group_width * flat_group_width }.match_empty() != 0) {
+				d.ctrl[i] = flat_ctrl_empty;
+				d.growth_left++;
+			}
+			else
+				d.ctrl[i] = flat_ctrl_deleted;
+		}
+
+		// this is empty
+		void copy_elements(const flat_hash_table& other) {
+			reserve(other.size());
+			for_each_full(other.data(), [&](size_type i) {
+				const size_type hash = other.hash_at(i);
+				const size_type j = find_insert_index(hash);
+				traits::construct(alloc_ref(), &Policy::element(data().slots + j), Policy::element(other.data().slots + i));
+				set_full(j, hash);
+			});
+		}
+
+		// hasher, key_equal and allocator take no space if they are empty
+		compress_pair<Hash, compress_pair<KeyEqual, compress_pair<Alloc, table_data>>> storage_;
+	};
+
+	template<typename Policy, typename Hash, typename KeyEqual, typename Alloc>
+	bool operator==(const flat_hash_table<Policy, Hash, KeyEqual, Alloc>& lhs, const flat_hash_table<Policy, Hash, KeyEqual, Alloc>& rhs) {
+		if (lhs.size() != rhs.size())
+			return false;
+		for (const auto& value : lhs) {
+			const auto target = rhs.find(Policy::key(value));
+			if (target == rhs.end() || !(*target == value))
+				return false;
+		}
+		return true;
+	}
+
+	template<typename Policy, typename Hash, typename KeyEqual, typename Alloc>
+	bool operator!=(const flat_hash_table<Policy, Hash, KeyEqual, Alloc>& lhs, const flat_hash_table<Policy, Hash, KeyEqual, Alloc>& rhs) {
+		return !(lhs == rhs);
+	}
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+
+#if defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace Ubpa::USTL::details {
+	// [mixer]
+	// wyhash-style: fold the 128-bit product of the two halves
+
+	inline constexpr std::uint64_t hash_k0 = 0xa0761d6478bd642full;
+	inline constexpr std::uint64_t hash_k1 = 0xe7037ed1a0b428dbull;
+	inline constexpr std::uint64_t hash_k2 = 0x8ebc6af09c88c6e3ull;
+
+	inline std::uint64_t hash_mum(std::uint64_t a, std::uint64_t b) noexcept {
+#if defined(__SIZEOF_INT128__)
+		const auto r = static_cast<unsigned __int128>(a) * b;
+		return static_cast<std::uint64_t>(r) ^ static_cast<std::uint64_t>(r >> 64);
+#elif defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+		std::uint64_t hi;
+		const std::uint64_t lo = _umul128(a, b, &hi);
+		return lo ^ hi;
+#else
+		const std::uint64_t a_lo = a & 0xFFFFFFFFu, a_hi = a >> 32;
+		const std::uint64_t b_lo = b & 0xFFFFFFFFu, b_hi = b >> 32;
+		const std::uint64_t ll = a_lo * b_lo, lh = a_lo * b_hi, hl = a_hi * b_lo, hh = a_hi * b_hi;
+		const std::uint64_t mid = (ll >> 32) + (lh & 0xFFFFFFFFu) + (hl & 0xFFFFFFFFu);
+		const std::uint64_t lo = (ll & 0xFFFFFFFFu) | (mid << 32);
+		const std::uint64_t hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+		return lo ^ hi;
+#endif
+	}
+}
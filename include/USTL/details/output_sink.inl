@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <type_traits>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace Ubpa::USTL::details {
+	template<typename T> struct is_output_sink : std::false_type {};
+	template<typename T> constexpr bool is_output_sink_v = is_output_sink<T>::value;
+
+	// signed char and unsigned char are written as characters, as std::ostream does
+	template<typename T>
+	constexpr bool is_sink_signed_unsigned_char_v = std::is_same_v<T, signed char> || std::is_same_v<T, unsigned char>;
+
+	// the sink holds bytes, wider characters must be encoded first
+	template<typename T>
+	constexpr bool is_sink_wide_char_v = std::is_same_v<T, wchar_t> || std::is_same_v<T, char16_t> || std::is_same_v<T, char32_t>
+#if defined(__cpp_char8_t)
+		|| std::is_same_v<T, char8_t>
+#endif
+		;
+
+	template<typename T>
+	constexpr bool is_sink_integer_v = std::is_integral_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char>
+		&& !is_sink_signed_unsigned_char_v<T> && !is_sink_wide_char_v<T>;
+
+	// the fd is stored in the context pointer
+	inline bool flush_to_fd(void* context, const char* data, std::size_t size) noexcept {
+		const int fd = static_cast<int>(reinterpret_cast<std::intptr_t>(context));
+		while (size != 0) {
+#if defined(_WIN32)
+			const unsigned chunk = size < 0x40000000u ? static_cast<unsigned>(size) : 0x40000000u;
+			const int n = ::_write(fd, data, chunk);
+#else
+			const auto n = ::write(fd, data, size);
+#endif
+			if (n < 0) {
+				if (errno == EINTR)
+					continue;
+				return false;
+			}
+			data += n;
+			size -= static_cast<std::size_t>(n);
+		}
+		return true;
+	}
+
+	inline bool flush_to_file(void* context, const char* data, std::size_t size) noexcept {
+		return std::fwrite(data, 1, size, static_cast<std::FILE*>(context)) == size;
+	}
+
+	// F: f(std::string_view), returning void or something convertible to bool
+	template<typename F>
+	bool flush_to_callback(void* context, const char* data, std::size_t size) {
+		F& f = *static_cast<F*>(context);
+		if constexpr (std::is_void_v<std::invoke_result_t<F&, std::string_view>>) {
+			f(std::string_view{ data, size });
+			return true;
+		}
+		else
+			return static_cast<bool>(f(std::string_view{ data, size }));
+	}
+}
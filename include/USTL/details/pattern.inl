@@ -0,0 +1,343 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace Ubpa::USTL::details {
+	// 256-bit byte set
+	struct pattern_charset {
+		std::array<std::uint64_t, 4> bits{};
+
+		constexpr void add(unsigned char c) noexcept { bits[c / 64] |= std::uint64_t{ 1 } << (c % 64); }
+
+		constexpr void add_range(unsigned char first, unsigned char last) noexcept {
+			for (unsigned c = first; c <= last; c++)
+				add(static_cast<unsigned char>(c));
+		}
+
+		constexpr void add_all() noexcept {
+			for (auto& b : bits)
+				b = ~std::uint64_t{ 0 };
+		}
+
+		constexpr void invert() noexcept {
+			for (auto& b : bits)
+				b = ~b;
+		}
+
+		constexpr bool contains(unsigned char c) const noexcept { return (bits[c / 64] >> (c % 64)) & 1; }
+	};
+
+	enum class pattern_quantifier : std::uint8_t { one, optional, star };
+
+	struct pattern_atom {
+		pattern_charset set;
+		pattern_quantifier quantifier = pattern_quantifier::one;
+	};
+
+	// atoms are NFA states 0..size-1, state size accepts
+	// 63 atoms at most, so a set of NFA states fits in a std::uint64_t
+	constexpr std::size_t pattern_max_atoms = 63;
+
+	struct pattern_program {
+		std::array<pattern_atom, pattern_max_atoms> atoms{};
+		std::size_t size = 0;
+		const char* error = nullptr;
+
+		constexpr void push(const pattern_charset& set, pattern_quantifier quantifier) noexcept {
+			if (size == pattern_max_atoms) {
+				error = "static_pattern: too many atoms.";
+				return;
+			}
+			atoms[size].set = set;
+			atoms[size].quantifier = quantifier;
+			size++;
+		}
+	};
+
+	// "[...]" starting at str[i] == '[', returns the index past ']'
+	constexpr std::size_t parse_pattern_class(std::string_view str, std::size_t i, bool glob,
+		pattern_charset& set, const char*& error) noexcept
+	{
+		i++;
+		bool negate = false;
+		if (i < str.size() && (str[i] == '^' || (glob && str[i] == '!'))) {
+			negate = true;
+			i++;
+		}
+		bool first = true;
+		while (i < str.size() && (str[i] != ']' || first)) {
+			first = false;
+			unsigned char lo = static_cast<unsigned char>(str[i]);
+			if (lo == '\\' && i + 1 < str.size())
+				lo = static_cast<unsigned char>(str[++i]);
+			i++;
+			if (i + 1 < str.size() && str[i] == '-' && str[i + 1] != ']') {
+				unsigned char hi = static_cast<unsigned char>(str[i + 1]);
+				i += 2;
+				if (hi == '\\' && i < str.size())
+					hi = static_cast<unsigned char>(str[i++]);
+				if (hi < lo) {
+					error = "static_pattern: invalid range in [...].";
+					return i;
+				}
+				set.add_range(lo, hi);
+			}
+			else
+				set.add(lo);
+		}
+		if (i == str.size()) {
+			error = "static_pattern: missing ']'.";
+			return i;
+		}
+		if (negate)
+			set.invert();
+		return i + 1;
+	}
+
+	// \d, \w, \s or an escaped literal
+	constexpr pattern_charset parse_pattern_escape(char c) noexcept {
+		pattern_charset set;
+		switch (c) {
+		case 'd':
+			set.add_range('0', '9');
+			break;
+		case 'w':
+			set.add_range('0', '9');
+			set.add_range('a', 'z');
+			set.add_range('A', 'Z');
+			set.add('_');
+			break;
+		case 's':
+			set.add(' ');
+			set.add_range('\t', '\r');
+			break;
+		default:
+			set.add(static_cast<unsigned char>(c));
+			break;
+		}
+		return set;
+	}
+
+	// glob: * ? [...] [!...] \x
+	constexpr pattern_program parse_glob(std::string_view str) noexcept {
+		pattern_program program;
+		std::size_t i = 0;
+		while (i < str.size() && !program.error) {
+			pattern_charset set;
+			switch (str[i]) {
+			case '*':
+				set.add_all();
+				program.push(set, pattern_quantifier::star);
+				i++;
+				break;
+			case '?':
+				set.add_all();
+				program.push(set, pattern_quantifier::one);
+				i++;
+				break;
+			case '[':
+				i = parse_pattern_class(str, i, true, set, program.error);
+				program.push(set, pattern_quantifier::one);
+				break;
+			case '\\':
+				if (i + 1 == str.size()) {
+					program.error = "static_pattern: trailing '\\'.";
+					break;
+				}
+				set.add(static_cast<unsigned char>(str[i + 1]));
+				program.push(set, pattern_quantifier::one);
+				i += 2;
+				break;
+			default:
+				set.add(static_cast<unsigned char>(str[i]));
+				program.push(set, pattern_quantifier::one);
+				i++;
+				break;
+			}
+		}
+		return program;
+	}
+
+	// regex subset, always a full match: . [...] [^...] \d \w \s \x, each optionally followed by * + ?
+	constexpr pattern_program parse_regex(std::string_view str) noexcept {
+		pattern_program program;
+		std::size_t i = 0;
+		while (i < str.size() && !program.error) {
+			pattern_charset set;
+			switch (str[i]) {
+			case '.':
+				set.add_all();
+				i++;
+				break;
+			case '[':
+				i = parse_pattern_class(str, i, false, set, program.error);
+				break;
+			case '\\':
+				if (i + 1 == str.size()) {
+					program.error = "static_pattern: trailing '\\'.";
+					return program;
+				}
+				set = parse_pattern_escape(str[i + 1]);
+				i += 2;
+				break;
+			case '*':
+			case '+':
+			case '?':
+				program.error = "static_pattern: quantifier without an atom.";
+				return program;
+			case '(':
+			case ')':
+			case '|':
+			case '{':
+			case '^':
+			case '$':
+				program.error = "static_pattern: groups, alternation, counted repetition and anchors are not supported.";
+				return program;
+			default:
+				set.add(static_cast<unsigned char>(str[i]));
+				i++;
+				break;
+			}
+			if (program.error)
+				return program;
+
+			const char q = i < str.size() ? str[i] : '\0';
+			if (q == '*') {
+				program.push(set, pattern_quantifier::star);
+				i++;
+			}
+			else if (q == '+') { // x+ == xx*
+				program.push(set, pattern_quantifier::one);
+				program.push(set, pattern_quantifier::star);
+				i++;
+			}
+			else if (q == '?') {
+				program.push(set, pattern_quantifier::optional);
+				i++;
+			}
+			else
+				program.push(set, pattern_quantifier::one);
+		}
+		return program;
+	}
+
+	// [NFA]
+
+	constexpr std::uint64_t pattern_closure(const pattern_program& program, std::uint64_t states) noexcept {
+		for (std::size_t i = 0; i < program.size; i++) {
+			if (((states >> i) & 1) && program.atoms[i].quantifier != pattern_quantifier::one)
+				states |= std::uint64_t{ 1 } << (i + 1);
+		}
+		return states;
+	}
+
+	constexpr std::uint64_t pattern_step(const pattern_program& program, std::uint64_t states, unsigned char c) noexcept {
+		std::uint64_t next = 0;
+		for (std::size_t i = 0; i < program.size; i++) {
+			if (((states >> i) & 1) && program.atoms[i].set.contains(c))
+				next |= std::uint64_t{ 1 } << (program.atoms[i].quantifier == pattern_quantifier::star ? i : i + 1);
+		}
+		return pattern_closure(program, next);
+	}
+
+	// [DFA]
+	// subset construction over byte classes, state 0 is the dead state
+
+	constexpr std::size_t pattern_max_states = 1024;
+
+	struct pattern_byte_classes {
+		std::array<std::uint8_t, 256> of{}; // byte -> class
+		std::array<std::uint8_t, 256> representative{}; // class -> byte
+		std::size_t count = 0;
+	};
+
+	constexpr pattern_byte_classes make_pattern_byte_classes(const pattern_program& program) noexcept {
+		// bytes belonging to exactly the same atoms are equivalent
+		std::array<std::uint64_t, 256> signatures{};
+		for (unsigned c = 0; c < 256; c++) {
+			for (std::size_t i = 0; i < program.size; i++)
+				signatures[c] |= std::uint64_t{ program.atoms[i].set.contains(static_cast<unsigned char>(c)) } << i;
+		}
+		pattern_byte_classes classes;
+		for (unsigned c = 0; c < 256; c++) {
+			std::size_t k = 0;
+			while (k < classes.count && signatures[classes.representative[k]] != signatures[c])
+				k++;
+			if (k == classes.count)
+				classes.representative[classes.count++] = static_cast<std::uint8_t>(c);
+			classes.of[c] = static_cast<std::uint8_t>(k);
+		}
+		return classes;
+	}
+
+	struct pattern_subsets {
+		std::array<std::uint64_t, pattern_max_states> states{};
+		std::size_t count = 0;
+		const char* error = nullptr;
+
+		constexpr std::size_t find_or_add(std::uint64_t set) noexcept {
+			for (std::size_t i = 0; i < count; i++) {
+				if (states[i] == set)
+					return i;
+			}
+			if (count == pattern_max_states) {
+				error = "static_pattern: DFA too large.";
+				return 0;
+			}
+			states[count] = set;
+			return count++;
+		}
+	};
+
+	// calls on_edge(from, class, to) for every DFA transition
+	template<typename OnEdge>
+	constexpr pattern_subsets make_pattern_subsets(const pattern_program& program,
+		const pattern_byte_classes& classes, OnEdge&& on_edge) noexcept
+	{
+		pattern_subsets subsets;
+		subsets.find_or_add(0);
+		subsets.find_or_add(pattern_closure(program, 1));
+		for (std::size_t s = 1; s < subsets.count && !subsets.error; s++) {
+			for (std::size_t k = 0; k < classes.count; k++) {
+				const std::size_t t = subsets.find_or_add(pattern_step(program, subsets.states[s], classes.representative[k]));
+				on_edge(s, k, t);
+			}
+		}
+		return subsets;
+	}
+
+	template<const auto& Pattern, bool Glob>
+	struct static_pattern_ {
+		static constexpr pattern_program program = Glob ? parse_glob(std::string_view{ Pattern }) : parse_regex(std::string_view{ Pattern });
+		static_assert(!program.error, "static_pattern: invalid pattern, see details::pattern_program::error.");
+
+		static constexpr pattern_byte_classes classes = make_pattern_byte_classes(program);
+
+		static constexpr pattern_subsets subsets = make_pattern_subsets(program, classes, [](std::size_t, std::size_t, std::size_t) {});
+		static_assert(!subsets.error, "static_pattern: DFA too large.");
+
+		static constexpr std::size_t state_count = subsets.count;
+		static constexpr std::size_t class_count = classes.count;
+
+		using state_type = std::conditional_t<(state_count <= 256), std::uint8_t, std::uint16_t>;
+
+		// transitions[state * class_count + class], dead state 0 loops on itself
+		static constexpr auto transitions = [] {
+			std::array<state_type, state_count * class_count> transitions{};
+			make_pattern_subsets(program, classes, [&](std::size_t s, std::size_t k, std::size_t t) {
+				transitions[s * class_count + k] = static_cast<state_type>(t);
+			});
+			return transitions;
+		}();
+
+		static constexpr auto accepts = [] {
+			std::array<bool, state_count> accepts{};
+			for (std::size_t s = 0; s < state_count; s++)
+				accepts[s] = (subsets.states[s] >> program.size) & 1;
+			return accepts;
+		}();
+	};
+}
@@ -0,0 +1,290 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define USTL_AVX2 1
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define USTL_SSE2 1
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+#if defined(_MSC_VER) || defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define USTL_LITTLE_ENDIAN 1
+#endif
+
+// true while constant-evaluating, used to pick the constexpr fallback over the SIMD path
+#if defined(__cpp_lib_is_constant_evaluated)
+#include <type_traits>
+#define USTL_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#elif defined(__GNUC__) && __GNUC__ >= 9 || defined(__clang__) && __clang_major__ >= 9 || defined(_MSC_VER) && _MSC_VER >= 1925
+#define USTL_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+#define USTL_IS_CONSTANT_EVALUATED() true // always take the constexpr path
+#endif
+
+namespace Ubpa::USTL::details {
+	// x != 0
+	inline unsigned countr_zero(std::uint32_t x) noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+		unsigned long idx;
+		_BitScanForward(&idx, x);
+		return static_cast<unsigned>(idx);
+#else
+		return static_cast<unsigned>(__builtin_ctz(x));
+#endif
+	}
+
+	// x != 0
+	inline unsigned countr_zero(std::uint64_t x) noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+		unsigned long idx;
+		_BitScanForward64(&idx, x);
+		return static_cast<unsigned>(idx);
+#else
+		return static_cast<unsigned>(__builtin_ctzll(x));
+#endif
+	}
+
+	// x != 0
+	inline unsigned countl_zero(std::uint32_t x) noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+		unsigned long idx;
+		_BitScanReverse(&idx, x);
+		return 31 - static_cast<unsigned>(idx);
+#else
+		return static_cast<unsigned>(__builtin_clz(x));
+#endif
+	}
+
+	inline unsigned popcount(std::uint32_t x) noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+		x = x - ((x >> 1) & 0x55555555u);
+		x = (x & 0x33333333u) + ((x >> 2) & 0x33333333u);
+		return static_cast<unsigned>((((x + (x >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24);
+#else
+		return static_cast<unsigned>(__builtin_popcount(x));
+#endif
+	}
+
+	inline unsigned popcount(std::uint64_t x) noexcept {
+		return popcount(static_cast<std::uint32_t>(x)) + popcount(static_cast<std::uint32_t>(x >> 32));
+	}
+
+	// [SIMD kernels]
+	// runtime only, return n / npos when not found
+
+	inline std::size_t simd_find_char(const char* str, std::size_t n, char c) noexcept {
+		std::size_t i = 0;
+#if USTL_AVX2
+		const __m256i c32 = _mm256_set1_epi8(c);
+		for (; i + 32 <= n; i += 32) {
+			const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str + i));
+			const auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, c32)));
+			if (mask != 0)
+				return i + countr_zero(mask);
+		}
+#endif
+#if USTL_SSE2
+		const __m128i c16 = _mm_set1_epi8(c);
+		for (; i + 16 <= n; i += 16) {
+			const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + i));
+			const auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, c16)));
+			if (mask != 0)
+				return i + countr_zero(mask);
+		}
+#endif
+		for (; i < n; i++) {
+			if (str[i] == c)
+				return i;
+		}
+		return static_cast<std::size_t>(-1);
+	}
+
+	inline std::size_t simd_rfind_char(const char* str, std::size_t n, char c) noexcept {
+		std::size_t i = n;
+#if USTL_AVX2
+		const __m256i c32 = _mm256_set1_epi8(c);
+		for (; i >= 32; i -= 32) {
+			const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str + i - 32));
+			const auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, c32)));
+			if (mask != 0)
+				return i - 1 - countl_zero(mask);
+		}
+#endif
+#if USTL_SSE2
+		const __m128i c16 = _mm_set1_epi8(c);
+		for (; i >= 16; i -= 16) {
+			const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + i - 16));
+			const auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, c16))) << 16;
+			if (mask != 0)
+				return i - 1 - countl_zero(mask);
+		}
+#endif
+		for (; i > 0; i--) {
+			if (str[i - 1] == c)
+				return i - 1;
+		}
+		return static_cast<std::size_t>(-1);
+	}
+
+	// index of the first different byte, n if equal
+	inline std::size_t simd_mismatch(const char* a, const char* b, std::size_t n) noexcept {
+		std::size_t i = 0;
+#if USTL_AVX2
+		for (; i + 32 <= n; i += 32) {
+			const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+			const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+			const auto mask = ~static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(va, vb)));
+			if (mask != 0)
+				return i + countr_zero(mask);
+		}
+#endif
+#if USTL_SSE2
+		for (; i + 16 <= n; i += 16) {
+			const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+			const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+			const auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(va, vb))) ^ 0xFFFFu;
+			if (mask != 0)
+				return i + countr_zero(mask);
+		}
+#endif
+		for (; i < n; i++) {
+			if (a[i] != b[i])
+				return i;
+		}
+		return n;
+	}
+
+	// first/last byte filter, then verify the candidates
+	inline std::size_t simd_find(const char* str, std::size_t n, const char* sub, std::size_t m) noexcept {
+		if (m == 0)
+			return 0;
+		if (m > n)
+			return static_cast<std::size_t>(-1);
+		if (m == 1)
+			return simd_find_char(str, n, sub[0]);
+
+		std::size_t i = 0;
+#if USTL_SSE2
+		const __m128i first = _mm_set1_epi8(sub[0]);
+		const __m128i last = _mm_set1_epi8(sub[m - 1]);
+		for (; i + m - 1 + 16 <= n; i += 16) {
+			const __m128i block_first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + i));
+			const __m128i block_last = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + i + m - 1));
+			auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(
+				_mm_and_si128(_mm_cmpeq_epi8(block_first, first), _mm_cmpeq_epi8(block_last, last))));
+			while (mask != 0) {
+				const std::size_t pos = i + countr_zero(mask);
+				if (std::memcmp(str + pos + 1, sub + 1, m - 2) == 0)
+					return pos;
+				mask &= mask - 1;
+			}
+		}
+#endif
+		for (; i + m <= n; i++) {
+			if (str[i] == sub[0] && std::memcmp(str + i + 1, sub + 1, m - 1) == 0)
+				return i;
+		}
+		return static_cast<std::size_t>(-1);
+	}
+
+	// [dispatch]
+	// constexpr fallback goes through std::string_view
+	// other char types always take the std::basic_string_view path
+
+	template<typename CharT>
+	constexpr std::size_t str_find(std::basic_string_view<CharT> str, CharT c, std::size_t pos) noexcept {
+		return str.find(c, pos);
+	}
+
+	template<typename CharT>
+	constexpr std::size_t str_find(std::basic_string_view<CharT> str, std::basic_string_view<CharT> sub, std::size_t pos) noexcept {
+		return str.find(sub, pos);
+	}
+
+	template<typename CharT>
+	constexpr std::size_t str_rfind(std::basic_string_view<CharT> str, CharT c, std::size_t pos) noexcept {
+		return str.rfind(c, pos);
+	}
+
+	template<typename CharT>
+	constexpr bool str_equal(std::basic_string_view<CharT> lhs, std::basic_string_view<CharT> rhs) noexcept {
+		return lhs == rhs;
+	}
+
+	template<typename CharT>
+	constexpr int str_compare(std::basic_string_view<CharT> lhs, std::basic_string_view<CharT> rhs) noexcept {
+		return lhs.compare(rhs);
+	}
+
+	constexpr std::size_t str_find(std::string_view str, char c, std::size_t pos) noexcept {
+		if (!USTL_IS_CONSTANT_EVALUATED()) {
+			if (pos >= str.size())
+				return std::string_view::npos;
+			const std::size_t i = simd_find_char(str.data() + pos, str.size() - pos, c);
+			return i == static_cast<std::size_t>(-1) ? std::string_view::npos : pos + i;
+		}
+		return str.find(c, pos);
+	}
+
+	constexpr std::size_t str_find(std::string_view str, std::string_view sub, std::size_t pos) noexcept {
+		if (!USTL_IS_CONSTANT_EVALUATED()) {
+			if (pos > str.size())
+				return std::string_view::npos;
+			const std::size_t i = simd_find(str.data() + pos, str.size() - pos, sub.data(), sub.size());
+			return i == static_cast<std::size_t>(-1) ? std::string_view::npos : pos + i;
+		}
+		return str.find(sub, pos);
+	}
+
+	constexpr std::size_t str_rfind(std::string_view str, char c, std::size_t pos) noexcept {
+		if (!USTL_IS_CONSTANT_EVALUATED()) {
+			const std::size_t n = pos < str.size() ? pos + 1 : str.size();
+			const std::size_t i = simd_rfind_char(str.data(), n, c);
+			return i == static_cast<std::size_t>(-1) ? std::string_view::npos : i;
+		}
+		return str.rfind(c, pos);
+	}
+
+	constexpr bool str_equal(std::string_view lhs, std::string_view rhs) noexcept {
+		if (lhs.size() != rhs.size())
+			return false;
+		if (!USTL_IS_CONSTANT_EVALUATED())
+			return simd_mismatch(lhs.data(), rhs.data(), lhs.size()) == lhs.size();
+		return lhs == rhs;
+	}
+
+	constexpr int str_compare(std::string_view lhs, std::string_view rhs) noexcept {
+		if (!USTL_IS_CONSTANT_EVALUATED()) {
+			const std::size_t n = lhs.size() < rhs.size() ? lhs.size() : rhs.size();
+			const std::size_t i = simd_mismatch(lhs.data(), rhs.data(), n);
+			if (i != n) {
+				return static_cast<unsigned char>(lhs[i]) < static_cast<unsigned char>(rhs[i]) ? -1 : 1;
+			}
+			return lhs.size() == rhs.size() ? 0 : (lhs.size() < rhs.size() ? -1 : 1);
+		}
+		return lhs.compare(rhs);
+	}
+
+	// dst may overlap src only if dst <= src
+	constexpr void str_copy(char* dst, const char* src, std::size_t n) noexcept {
+		if (!USTL_IS_CONSTANT_EVALUATED()) {
+			if (n != 0)
+				std::memmove(dst, src, n);
+			return;
+		}
+		for (std::size_t i = 0; i < n; i++)
+			dst[i] = src[i];
+	}
+}
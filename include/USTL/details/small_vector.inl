@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace Ubpa::USTL::details {
+	template<typename Alloc, typename T, typename = void>
+	struct alloc_has_construct : std::false_type {};
+	template<typename Alloc, typename T>
+	struct alloc_has_construct<Alloc, T, std::void_t<decltype(std::declval<Alloc&>().construct(std::declval<T*>(), std::declval<T&&>()))>>
+		: std::true_type {};
+
+	template<typename Alloc, typename T, typename = void>
+	struct alloc_has_destroy : std::false_type {};
+	template<typename Alloc, typename T>
+	struct alloc_has_destroy<Alloc, T, std::void_t<decltype(std::declval<Alloc&>().destroy(std::declval<T*>()))>>
+		: std::true_type {};
+
+	// std::allocator may declare construct / destroy (until C++20), they do the default
+	template<typename Alloc, typename T>
+	constexpr bool alloc_is_default_construct_v = std::is_same_v<Alloc, std::allocator<T>>
+		|| (!alloc_has_construct<Alloc, T>::value && !alloc_has_destroy<Alloc, T>::value);
+
+	// moving an element to new storage and destroying the old one is a byte copy
+	// (the allocator must not customize construct / destroy, those would be skipped)
+	template<typename T, typename Alloc>
+	constexpr bool is_trivially_relocatable_v = std::is_trivially_copyable_v<T> && alloc_is_default_construct_v<Alloc, T>;
+
+	// [first, first + n) to the uninitialized dst, the sources are destroyed
+	// moves if it cannot throw (or T cannot be copied), copies otherwise;
+	// if that throws, the constructed part of dst is destroyed and the sources are untouched
+	template<typename T, typename Alloc>
+	void small_vector_relocate(Alloc& alloc, T* first, std::size_t n, T* dst) {
+		using traits = std::allocator_traits<Alloc>;
+		if constexpr (is_trivially_relocatable_v<T, Alloc>) {
+			if (n != 0)
+				std::memcpy(static_cast<void*>(dst), static_cast<const void*>(first), n * sizeof(T));
+		}
+		else {
+			std::size_t i = 0;
+			try {
+				for (; i < n; i++)
+					traits::construct(alloc, dst + i, std::move_if_noexcept(first[i]));
+			}
+			catch (...) {
+				for (std::size_t j = 0; j < i; j++)
+					traits::destroy(alloc, dst + j);
+				throw;
+			}
+			for (std::size_t j = 0; j < n; j++)
+				traits::destroy(alloc, first + j);
+		}
+	}
+
+	template<typename T, typename Alloc>
+	void small_vector_destroy(Alloc& alloc, T* first, T* last) noexcept {
+		if constexpr (!std::is_trivially_destructible_v<T> || !alloc_is_default_construct_v<Alloc, T>) {
+			for (; first != last; ++first)
+				std::allocator_traits<Alloc>::destroy(alloc, first);
+		}
+	}
+}
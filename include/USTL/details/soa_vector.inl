@@ -0,0 +1,62 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace Ubpa::USTL::details {
+	constexpr std::size_t soa_align_up(std::size_t n, std::size_t align) noexcept {
+		return (n + align - 1) / align * align;
+	}
+
+	// moves if it cannot throw (or T cannot be copied), copies otherwise
+	template<typename T>
+	void soa_relocate(T* first, std::size_t n, T* dst) {
+		if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>)
+			std::uninitialized_move(first, first + n, dst);
+		else
+			std::uninitialized_copy(first, first + n, dst);
+	}
+
+	// order of the columns in a relocation: copies may throw but keep the old elements, so they go first;
+	// throwing moves of move-only columns next, nothrow moves last since they cannot be undone by a throw
+	template<typename T>
+	constexpr int soa_relocate_pass_v = std::is_nothrow_move_constructible_v<T> ? 2 : (std::is_copy_constructible_v<T> ? 0 : 1);
+
+	// one block: column 0 | pad | column 1 | pad | ..., each column aligned to Align
+	template<std::size_t Align, typename... Ts>
+	struct soa_layout {
+		static constexpr std::size_t alignment = std::max({ Align, alignof(Ts)... });
+
+		template<std::size_t... Is>
+		static std::size_t offsets(std::size_t capacity, std::size_t(&rst)[sizeof...(Ts)], std::index_sequence<Is...>) noexcept {
+			std::size_t offset = 0;
+			((rst[Is] = offset = soa_align_up(offset, alignment), offset += sizeof(Ts) * capacity), ...);
+			return offset;
+		}
+
+		static void* allocate(std::size_t capacity, std::tuple<Ts*...>& columns) {
+			std::size_t column_offsets[sizeof...(Ts)];
+			const std::size_t bytes = offsets(capacity, column_offsets, std::index_sequence_for<Ts...>{});
+			auto* block = static_cast<std::byte*>(::operator new(bytes, std::align_val_t{ alignment }));
+			set_columns(block, column_offsets, columns, std::index_sequence_for<Ts...>{});
+			return block;
+		}
+
+		static void deallocate(void* block) noexcept {
+			if (block)
+				::operator delete(block, std::align_val_t{ alignment });
+		}
+
+		template<std::size_t... Is>
+		static void set_columns(std::byte* block, const std::size_t(&column_offsets)[sizeof...(Ts)],
+			std::tuple<Ts*...>& columns, std::index_sequence<Is...>) noexcept
+		{
+			((std::get<Is>(columns) = reinterpret_cast<Ts*>(block + column_offsets[Is])), ...);
+		}
+	};
+}
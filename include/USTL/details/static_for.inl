@@ -0,0 +1,57 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace Ubpa::USTL::details {
+	template<typename Array, typename = void>
+	struct array_size : std::tuple_size<Array> {};
+
+	template<typename T, std::size_t N>
+	struct array_size<T[N]> : std::integral_constant<std::size_t, N> {};
+
+	template<typename Array>
+	constexpr std::size_t array_size_v = array_size<std::remove_cv_t<std::remove_reference_t<Array>>>::value;
+
+	// [static_for]
+	// a comma fold, each call sees its index as a constant expression
+
+	template<bool Mask, std::size_t I, typename Func>
+	constexpr void static_for_at(Func& f) {
+		if constexpr (Mask)
+			f(std::integral_constant<std::size_t, I>{});
+	}
+
+	template<bool... Masks, typename Func, std::size_t... Is>
+	constexpr void static_for(Func& f, std::index_sequence<Is...>) {
+		(static_for_at<tuple_mask_at<Masks...>(Is), Is>(f), ...);
+	}
+
+	// [array algorithms]
+	// element I is a[I], nothing is indexed at runtime
+
+	template<bool Mask, std::size_t I, typename Array, typename Func>
+	constexpr void array_for_each_at(Array& a, Func& f) {
+		if constexpr (Mask)
+			f(a[I]);
+	}
+
+	template<bool... Masks, typename Array, typename Func, std::size_t... Is>
+	constexpr void array_for_each(Array& a, Func& f, std::index_sequence<Is...>) {
+		(array_for_each_at<tuple_mask_at<Masks...>(Is), Is>(a, f), ...);
+	}
+
+	template<bool Mask, std::size_t I, typename Acc, typename Array, typename Func>
+	constexpr void array_accumulate_at(Acc& acc, Array& a, Func& f) {
+		if constexpr (Mask)
+			acc = f(std::move(acc), a[I]);
+	}
+
+	template<bool... Masks, typename Acc, typename Array, typename Func, std::size_t... Is>
+	constexpr Acc array_accumulate(Acc acc, Array& a, Func& f, std::index_sequence<Is...>) {
+		(array_accumulate_at<tuple_mask_at<Masks...>(Is), Is>(acc, a, f), ...);
+		return acc;
+	}
+}
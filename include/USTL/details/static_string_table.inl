@@ -0,0 +1,59 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace Ubpa::USTL::details {
+	template<std::size_t Count, std::size_t Total>
+	struct static_string_layout {
+		std::array<char, Total + 1> chars{};
+		std::size_t size{ 0 };
+		std::array<std::uint32_t, Count> offsets{};
+	};
+
+	// longest strings first, so shorter ones are found inside them
+	// a string already in the blob (as a whole or a substring) is not appended again
+	template<std::size_t Total, std::size_t Count>
+	constexpr auto static_string_layout_(const std::array<std::string_view, Count>& strs) noexcept {
+		std::array<std::size_t, Count> order{};
+		for (std::size_t i = 0; i < Count; i++) {
+			std::size_t j = i;
+			for (; j > 0 && strs[order[j - 1]].size() < strs[i].size(); j--)
+				order[j] = order[j - 1];
+			order[j] = i;
+		}
+
+		static_string_layout<Count, Total> layout;
+		for (std::size_t k = 0; k < Count; k++) {
+			const std::string_view str = strs[order[k]];
+			std::size_t offset = std::string_view{ layout.chars.data(), layout.size }.find(str);
+			if (offset == std::string_view::npos) {
+				offset = layout.size;
+				for (std::size_t i = 0; i < str.size(); i++)
+					layout.chars[layout.size++] = str[i];
+			}
+			layout.offsets[order[k]] = static_cast<std::uint32_t>(offset);
+		}
+		return layout;
+	}
+
+	template<const auto&... Strs>
+	struct static_string_table_storage {
+		static constexpr std::array<std::string_view, sizeof...(Strs)> strs{ std::string_view{ Strs }... };
+		static constexpr std::size_t total = (std::string_view{ Strs }.size() + ... + 0);
+		static_assert(total < 0xFFFFFFFFu, "static_string_table: blob too large.");
+
+		static constexpr auto layout = static_string_layout_<total>(strs);
+
+		// the blob keeps only the used characters, '\0' terminated
+		static constexpr auto blob_() noexcept {
+			std::array<char, layout.size + 1> chars{};
+			for (std::size_t i = 0; i < layout.size; i++)
+				chars[i] = layout.chars[i];
+			return chars;
+		}
+		static constexpr std::array<char, layout.size + 1> blob = blob_();
+	};
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string_view>
+#include <vector>
+
+namespace Ubpa::USTL::details {
+	struct interner_entry {
+		std::uint64_t id;
+		std::string_view str; // points right after the entry, in the same arena block
+	};
+
+	// open addressing, linear probing, never shrinks
+	// a full table is replaced, not resized, so readers may keep probing an old one
+	struct interner_table {
+		explicit interner_table(std::size_t capacity)
+			: mask{ capacity - 1 }, slots{ std::make_unique<std::atomic<const interner_entry*>[]>(capacity) } {}
+
+		const interner_entry* find(std::uint64_t id, std::string_view str) const noexcept {
+			for (std::size_t i = static_cast<std::size_t>(id) & mask;; i = (i + 1) & mask) {
+				const interner_entry* e = slots[i].load(std::memory_order_acquire);
+				if (!e || (e->id == id && e->str == str))
+					return e;
+			}
+		}
+
+		const interner_entry* find(std::uint64_t id) const noexcept {
+			for (std::size_t i = static_cast<std::size_t>(id) & mask;; i = (i + 1) & mask) {
+				const interner_entry* e = slots[i].load(std::memory_order_acquire);
+				if (!e || e->id == id)
+					return e;
+			}
+		}
+
+		// the caller holds the shard lock and made sure e is not in the table
+		void insert(const interner_entry* e) noexcept {
+			std::size_t i = static_cast<std::size_t>(e->id) & mask;
+			while (slots[i].load(std::memory_order_relaxed))
+				i = (i + 1) & mask;
+			slots[i].store(e, std::memory_order_release);
+		}
+
+		std::size_t mask;
+		std::unique_ptr<std::atomic<const interner_entry*>[]> slots;
+	};
+
+	// bump allocator, blocks are freed with the interner
+	class interner_arena {
+	public:
+		static constexpr std::size_t block_size = 64 * 1024;
+
+		const interner_entry* create(std::uint64_t id, std::string_view str) {
+			const std::size_t n = sizeof(interner_entry) + str.size();
+			char* p = allocate(n);
+			char* chars = p + sizeof(interner_entry);
+			if (!str.empty())
+				std::memcpy(chars, str.data(), str.size());
+			return new (p) interner_entry{ id, { chars, str.size() } };
+		}
+
+	private:
+		char* allocate(std::size_t n) {
+			constexpr std::size_t align = alignof(interner_entry);
+			n = (n + align - 1) & ~(align - 1);
+			if (n > block_size / 4) {
+				blocks_.push_back(std::make_unique<char[]>(n));
+				return blocks_.back().get();
+			}
+			if (n > left_) {
+				blocks_.push_back(std::make_unique<char[]>(block_size));
+				cur_ = blocks_.back().get();
+				left_ = block_size;
+			}
+			char* p = cur_;
+			cur_ += n;
+			left_ -= n;
+			return p;
+		}
+
+		std::vector<std::unique_ptr<char[]>> blocks_;
+		char* cur_{ nullptr };
+		std::size_t left_{ 0 };
+	};
+
+	struct alignas(64) interner_shard {
+		interner_shard() : table{ tables.emplace_back(std::make_unique<interner_table>(initial_capacity)).get() } {}
+
+		static constexpr std::size_t initial_capacity = 64;
+
+		std::vector<std::unique_ptr<interner_table>> tables; // every table ever published, the last one is current
+		std::atomic<const interner_table*> table;
+
+		std::mutex mutex; // guards writes
+		interner_arena arena;
+		std::size_t count{ 0 };
+	};
+}
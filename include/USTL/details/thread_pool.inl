@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <mutex>
+
+namespace Ubpa::USTL::details {
+	struct pool_task {
+		void (*run)(void* context, std::size_t index);
+		void* context;
+		std::size_t index;
+	};
+
+	// the owner works LIFO at the back, thieves take the oldest task at the front
+	class pool_task_queue {
+	public:
+		void push(const pool_task& task) {
+			std::lock_guard<std::mutex> lock{ mutex_ };
+			tasks_.push_back(task);
+		}
+
+		bool pop(pool_task& task) {
+			std::lock_guard<std::mutex> lock{ mutex_ };
+			if (tasks_.empty())
+				return false;
+			task = tasks_.back();
+			tasks_.pop_back();
+			return true;
+		}
+
+		bool steal(pool_task& task) {
+			std::unique_lock<std::mutex> lock{ mutex_, std::try_to_lock };
+			if (!lock || tasks_.empty())
+				return false;
+			task = tasks_.front();
+			tasks_.pop_front();
+			return true;
+		}
+
+	private:
+		std::mutex mutex_;
+		std::deque<pool_task> tasks_;
+	};
+}
@@ -1,68 +1,196 @@
 #pragma once
 
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 
+#include "simd.inl"
+
 namespace Ubpa::USTL::details {
-	template<typename Ints> struct IntegerSequenceTraits;
+	// get<I>(t), std::get or the one found by ADL (tuple views, user tuple-likes)
+	template<std::size_t I, typename Tuple>
+	constexpr decltype(auto) tuple_get(Tuple&& t) {
+		using std::get;
+		return get<I>(std::forward<Tuple>(t));
+	}
+
+	// Masks... padded with true up to the tuple size
+	template<bool... Masks>
+	constexpr bool tuple_mask_at(std::size_t i) noexcept {
+		constexpr bool masks[] = { Masks..., true };
+		return i < sizeof...(Masks) ? masks[i] : true;
+	}
+
+	// [tuple_accumulate]
+	// a left fold over operator<<, no recursion: (holder << ... << elem<Ns>)
+	// Acc is the type f returned (Init&& at first), so it is forwarded as the recursive version did
 
-	template<typename T, T N0, T... Ns>
-	struct IntegerSequenceTraits<std::integer_sequence<T, N0, Ns...>> {
-		static constexpr size_t head = N0;
-		static constexpr auto tail = std::integer_sequence<T, Ns...>{};
+	template<typename Acc, typename Func>
+	struct accumulate_holder {
+		Acc acc;
+		Func& f;
 	};
 
-	template<typename Tuple, typename Acc, typename Func, bool... Masks, size_t... Ns>
-	constexpr auto tuple_accumulate(Tuple&& t, Acc&& acc, Func&& f,
-		std::integer_sequence<bool, Masks...>, std::index_sequence<Ns...>)
-	{
-		if constexpr (sizeof...(Ns) > 0) {
-			using IST_Ns = IntegerSequenceTraits<std::index_sequence<Ns...>>;
-			if constexpr (sizeof...(Masks) > 0) {
-				using IST_Masks = IntegerSequenceTraits<std::integer_sequence<bool, Masks...>>;
-				if constexpr (IST_Masks::head) {
-					return tuple_accumulate(
-						std::forward<Tuple>(t),
-						f(std::forward<Acc>(acc), std::get<IST_Ns::head>(std::forward<Tuple>(t))),
-						std::forward<Func>(f),
-						IST_Masks::tail,
-						IST_Ns::tail
-					);
-				}
-				else {
-					return tuple_accumulate(
-						std::forward<Tuple>(t),
-						std::forward<Acc>(acc),
-						std::forward<Func>(f),
-						IST_Masks::tail,
-						IST_Ns::tail
-					);
-				}
-			}
-			else {
-				return tuple_accumulate(
-					std::forward<Tuple>(t),
-					f(std::forward<Acc>(acc), std::get<IST_Ns::head>(std::forward<Tuple>(t))),
-					std::forward<Func>(f),
-					std::integer_sequence<bool>{},
-					IST_Ns::tail
-				);
-			}
+	template<bool Mask, typename Elem>
+	struct accumulate_elem {
+		Elem&& elem;
+	};
+
+	template<typename Acc, typename Func, bool Mask, typename Elem>
+	constexpr decltype(auto) operator<<(accumulate_holder<Acc, Func>&& h, accumulate_elem<Mask, Elem> e) {
+		if constexpr (Mask) {
+			using Result = decltype(h.f(std::forward<Acc>(h.acc), std::forward<Elem>(e.elem)));
+			return accumulate_holder<Result, Func>{ h.f(std::forward<Acc>(h.acc), std::forward<Elem>(e.elem)), h.f };
 		}
 		else
-			return std::forward<Acc>(acc);
+			return std::move(h);
 	}
 
-	template<typename Tuple, typename Func, size_t... Ns>
-	constexpr size_t tuple_find_if(const Tuple& t, Func&& f, std::index_sequence<Ns...>) {
-		if constexpr (sizeof...(Ns) > 0) {
-			using IST_Ns = IntegerSequenceTraits<std::index_sequence<Ns...>>;
-			if (std::forward<Func>(f)(std::get<IST_Ns::head>(t)))
-				return IST_Ns::head;
-			else
-				return tuple_find_if(t, std::forward<Func>(f), IST_Ns::tail);
+	template<typename Acc, typename Func>
+	constexpr auto accumulate_result(accumulate_holder<Acc, Func>&& h) {
+		return std::forward<Acc>(h.acc);
+	}
+
+	template<bool... Masks, typename Tuple, typename Init, typename Func, std::size_t... Ns>
+	constexpr auto tuple_accumulate(Tuple&& t, Init&& i, Func& f, std::index_sequence<Ns...>) {
+		return accumulate_result((accumulate_holder<Init&&, Func>{ std::forward<Init>(i), f } << ... <<
+			accumulate_elem<tuple_mask_at<Masks...>(Ns), decltype(details::tuple_get<Ns>(std::forward<Tuple>(t)))>{
+				details::tuple_get<Ns>(std::forward<Tuple>(t))
+			}));
+	}
+
+	template<bool Mask, std::size_t N, typename Tuple, typename Func>
+	constexpr void tuple_for_each_at(Tuple&& t, Func&& f) {
+		if constexpr (Mask)
+			std::forward<Func>(f)(details::tuple_get<N>(std::forward<Tuple>(t)));
+	}
+
+	template<bool... Masks, typename Tuple, typename Func, std::size_t... Ns>
+	constexpr void tuple_for_each(Tuple&& t, Func&& f, std::index_sequence<Ns...>) {
+		(tuple_for_each_at<tuple_mask_at<Masks...>(Ns), Ns>(std::forward<Tuple>(t), std::forward<Func>(f)), ...);
+	}
+
+	// || short-circuits, so f is called up to the first match as before
+	template<typename Tuple, typename Func, std::size_t... Ns>
+	constexpr std::size_t tuple_find_if(const Tuple& t, Func&& f, std::index_sequence<Ns...>) {
+		std::size_t index = static_cast<std::size_t>(-1);
+		((std::forward<Func>(f)(details::tuple_get<Ns>(t)) ? (index = Ns, true) : false) || ...);
+		return index;
+	}
+
+	// [tuple types]
+	// element types matched against T by a fold over the pack, no recursion
+	// Decay: compare std::decay_t of the element types (as tuple_find does)
+
+	template<typename T, typename Tuple, bool Decay, typename Ns = std::make_index_sequence<std::tuple_size_v<Tuple>>>
+	struct tuple_type_matches;
+
+	template<typename T, typename Tuple, bool Decay, std::size_t... Ns>
+	struct tuple_type_matches<T, Tuple, Decay, std::index_sequence<Ns...>> {
+		template<typename E>
+		static constexpr bool match = std::is_same_v<T, std::conditional_t<Decay, std::decay_t<E>, E>>;
+		static constexpr bool value[] = { false, match<std::tuple_element_t<Ns, Tuple>>... }; // value[0] is padding
+	};
+
+	// std::tuple_element of std::tuple may recurse, take the pack directly
+	template<typename T, typename... Ts, bool Decay, std::size_t... Ns>
+	struct tuple_type_matches<T, std::tuple<Ts...>, Decay, std::index_sequence<Ns...>> {
+		template<typename E>
+		static constexpr bool match = std::is_same_v<T, std::conditional_t<Decay, std::decay_t<E>, E>>;
+		static constexpr bool value[] = { false, match<Ts>... };
+	};
+
+	template<typename T, typename Tuple, bool Decay>
+	struct tuple_type_indices {
+		using matches = tuple_type_matches<T, Tuple, Decay>;
+		static constexpr std::size_t size = std::tuple_size_v<Tuple>;
+
+		static constexpr std::size_t count = [] {
+			std::size_t n = 0;
+			for (std::size_t i = 0; i < size; i++)
+				n += matches::value[i + 1];
+			return n;
+		}();
+
+		static constexpr std::array<std::size_t, count> indices = [] {
+			std::array<std::size_t, count> rst{};
+			std::size_t k = 0;
+			for (std::size_t i = 0; i < size; i++) {
+				if (matches::value[i + 1])
+					rst[k++] = i;
+			}
+			return rst;
+		}();
+
+		template<std::size_t... Ks>
+		static constexpr auto sequence(std::index_sequence<Ks...>) noexcept {
+			return std::index_sequence<indices[Ks]...>{};
 		}
-		else
-			return static_cast<size_t>(-1);
+		using type = decltype(sequence(std::make_index_sequence<count>{}));
+
+		static constexpr std::size_t first = count > 0 ? indices[0] : static_cast<std::size_t>(-1);
+	};
+
+	// only elements of type Elem are compared
+	template<typename Tuple, typename Elem, std::size_t... Ns>
+	constexpr std::size_t tuple_find(const Tuple& t, const Elem& e, std::index_sequence<Ns...>) {
+		std::size_t index = static_cast<std::size_t>(-1);
+		((details::tuple_get<Ns>(t) == e ? (index = Ns, true) : false) || ...);
+		return index;
+	}
+
+	template<typename Tuple, typename Elem, std::size_t... Ns>
+	constexpr std::size_t tuple_count(const Tuple& t, const Elem& e, std::index_sequence<Ns...>) {
+		return (std::size_t{ 0 } + ... + (details::tuple_get<Ns>(t) == e ? std::size_t{ 1 } : std::size_t{ 0 }));
+	}
+
+	// [tuple_visit_at]
+	// one function per element, called through a constexpr table indexed at runtime
+	// up to tuple_visit_chain_max elements, an if chain is cheaper than the indirect call
+
+	constexpr std::size_t tuple_visit_chain_max = 8;
+
+	template<std::size_t I, typename R, typename Tuple, typename Func>
+	constexpr R tuple_visit_chain(Tuple&& t, std::size_t index, Func&& f) {
+		if constexpr (I + 1 < std::tuple_size_v<std::decay_t<Tuple>>) {
+			if (index != I)
+				return tuple_visit_chain<I + 1, R>(std::forward<Tuple>(t), index, std::forward<Func>(f));
+		}
+		return std::forward<Func>(f)(details::tuple_get<I>(std::forward<Tuple>(t)));
+	}
+
+	template<std::size_t N, typename R, typename Tuple, typename Func>
+	constexpr R tuple_visit_at_(Tuple&& t, Func&& f) {
+		return std::forward<Func>(f)(details::tuple_get<N>(std::forward<Tuple>(t)));
+	}
+
+	template<typename Tuple, typename Func, typename Ns>
+	struct tuple_visit_table;
+
+	template<typename Tuple, typename Func, std::size_t... Ns>
+	struct tuple_visit_table<Tuple, Func, std::index_sequence<Ns...>> {
+		using R = decltype(std::declval<Func>()(details::tuple_get<0>(std::declval<Tuple>())));
+		static_assert((std::is_same_v<R, decltype(std::declval<Func>()(details::tuple_get<Ns>(std::declval<Tuple>())))> && ...),
+			"tuple_visit_at requires f to return the same type for every element.");
+
+		using Visitor = R(*)(Tuple&&, Func&&);
+		static constexpr Visitor visitors[] = { &tuple_visit_at_<Ns, R, Tuple, Func>... };
+	};
+
+	// [tuple_for_each_mask]
+	// sparse: one table call per set bit, the bits are found with countr_zero
+	// dense: a test per element is cheaper than an indirect call per bit
+
+	template<std::size_t N>
+	constexpr std::uint64_t tuple_mask_bits = N == 64 ? ~std::uint64_t{ 0 } : (std::uint64_t{ 1 } << N) - 1;
+
+	template<typename Tuple, typename Func, std::size_t... Ns>
+	void tuple_for_each_bit(Tuple&& t, std::uint64_t mask, Func& f, std::index_sequence<Ns...>) {
+		((mask >> Ns & 1 ? f(details::tuple_get<Ns>(std::forward<Tuple>(t))) : void()), ...);
 	}
 }
 
@@ -71,27 +199,52 @@ namespace Ubpa::USTL {
 	constexpr auto tuple_accumulate(Tuple&& t, Init&& i, Func&& f) {
 		constexpr size_t N = std::tuple_size_v<std::decay_t<Tuple>>;
 		static_assert(sizeof...(Masks) <= N);
-		return details::tuple_accumulate(
+		return details::tuple_accumulate<Masks...>(
 			std::forward<Tuple>(t),
 			std::forward<Init>(i),
-			std::forward<Func>(f),
-			std::integer_sequence<bool, Masks...>{},
+			f,
 			std::make_index_sequence<N>{}
 		);
 	}
 
 	template<bool... Masks, typename Tuple, typename Func>
 	constexpr void tuple_for_each(Tuple&& t, Func&& f) {
-		tuple_accumulate<Masks...>(
+		constexpr size_t N = std::tuple_size_v<std::decay_t<Tuple>>;
+		static_assert(sizeof...(Masks) <= N);
+		details::tuple_for_each<Masks...>(
 			std::forward<Tuple>(t),
-			0,
-			[&](auto, auto&& val) {
-				std::forward<Func>(f)(std::forward<decltype(val)>(val));
-				return 0;
-			}
+			std::forward<Func>(f),
+			std::make_index_sequence<N>{}
 		);
 	}
 
+	template<typename Tuple, typename Func>
+	void tuple_for_each_mask(Tuple&& t, std::uint64_t mask, Func&& f) {
+		constexpr size_t N = std::tuple_size_v<std::decay_t<Tuple>>;
+		static_assert(N <= 64, "tuple_for_each_mask supports up to 64 elements.");
+		if constexpr (N > 0) {
+			// the elements may give f different return types, the table needs one
+			auto visit = [&f](auto&& e) { f(std::forward<decltype(e)>(e)); };
+			using Table = details::tuple_visit_table<Tuple, decltype(visit)&, std::make_index_sequence<N>>;
+			mask &= details::tuple_mask_bits<N>;
+			if (details::popcount(mask) * 8 > N) {
+				details::tuple_for_each_bit(std::forward<Tuple>(t), mask, visit, std::make_index_sequence<N>{});
+				return;
+			}
+			for (; mask != 0; mask &= mask - 1)
+				Table::visitors[details::countr_zero(mask)](std::forward<Tuple>(t), visit);
+		}
+	}
+
+	template<typename Tuple, typename Init, typename Func>
+	std::decay_t<Init> tuple_accumulate_mask(Tuple&& t, std::uint64_t mask, Init&& i, Func&& f) {
+		std::decay_t<Init> acc = std::forward<Init>(i);
+		tuple_for_each_mask(std::forward<Tuple>(t), mask, [&](auto&& e) {
+			acc = f(std::move(acc), std::forward<decltype(e)>(e));
+		});
+		return acc;
+	}
+
 	template<typename Tuple, typename Func>
 	constexpr size_t tuple_find_if(const Tuple& t, Func&& f) {
 		return details::tuple_find_if(
@@ -103,15 +256,7 @@ namespace Ubpa::USTL {
 
 	template<typename Tuple, typename Elem>
 	constexpr size_t tuple_find(const Tuple& t, const Elem& e) {
-		return tuple_find_if(
-			t,
-			[&](const auto& t_e) {
-				if constexpr (std::is_same_v<std::decay_t<decltype(t_e)>, Elem>)
-					return t_e == e;
-				else
-					return false;
-			}
-		);
+		return details::tuple_find(t, e, typename details::tuple_type_indices<Elem, Tuple, true>::type{});
 	}
 
 	template<typename Tuple, typename Elem>
@@ -119,6 +264,18 @@ namespace Ubpa::USTL {
 		return tuple_find(t, e) != static_cast<size_t>(-1);
 	}
 
+	template<typename Tuple, typename Func>
+	constexpr decltype(auto) tuple_visit_at(Tuple&& t, size_t index, Func&& f) {
+		constexpr size_t N = std::tuple_size_v<std::decay_t<Tuple>>;
+		static_assert(N > 0, "tuple_visit_at needs a non-empty tuple.");
+		assert(index < N);
+		using Table = details::tuple_visit_table<Tuple, Func, std::make_index_sequence<N>>;
+		if constexpr (N <= details::tuple_visit_chain_max)
+			return details::tuple_visit_chain<0, typename Table::R>(std::forward<Tuple>(t), index, std::forward<Func>(f));
+		else
+			return Table::visitors[index](std::forward<Tuple>(t), std::forward<Func>(f));
+	}
+
 	template<typename Tuple, typename Func>
 	constexpr size_t tuple_count_if(const Tuple& t, Func&& f) {
 		return tuple_accumulate(t, 0, [&](auto cnt, const auto& e) {
@@ -131,15 +288,7 @@ namespace Ubpa::USTL {
 
 	template<typename Tuple, typename Elem>
 	constexpr size_t tuple_count(const Tuple& t, const Elem& e) {
-		return tuple_count_if(
-			t,
-			[&](const auto& t_e) {
-				if constexpr (std::is_same_v<std::decay_t<decltype(t_e)>, Elem>)
-					return t_e == e;
-				else
-					return false;
-			}
-		);
+		return details::tuple_count(t, e, typename details::tuple_type_indices<Elem, Tuple, true>::type{});
 	}
 
 	template<typename Tuple, typename... Elems>
@@ -0,0 +1,179 @@
+#pragma once
+
+#include "hash_mix.inl"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace Ubpa::USTL::details {
+	inline std::uint64_t hash_read64(const char* p) noexcept {
+		std::uint64_t v;
+		std::memcpy(&v, p, 8);
+		return v;
+	}
+
+	inline std::uint64_t hash_read32(const char* p) noexcept {
+		std::uint32_t v;
+		std::memcpy(&v, p, 4);
+		return v;
+	}
+
+	// one pass, 16 bytes per step; with a constant n the length dispatch folds away
+	inline std::uint64_t hash_bytes(const char* p, std::size_t n, std::uint64_t seed) noexcept {
+		std::uint64_t a, b;
+		if (n <= 16) {
+			if (n >= 4) {
+				const std::size_t d = (n >> 3) << 2;
+				a = (hash_read32(p) << 32) | hash_read32(p + d);
+				b = (hash_read32(p + n - 4) << 32) | hash_read32(p + n - 4 - d);
+			}
+			else if (n > 0) {
+				a = (std::uint64_t{ static_cast<unsigned char>(p[0]) } << 16)
+					| (std::uint64_t{ static_cast<unsigned char>(p[n >> 1]) } << 8)
+					| static_cast<unsigned char>(p[n - 1]);
+				b = 0;
+			}
+			else
+				a = b = 0;
+		}
+		else {
+			std::size_t i = n;
+			for (; i > 16; i -= 16, p += 16)
+				seed = hash_mum(hash_read64(p) ^ hash_k1, hash_read64(p + 8) ^ seed);
+			a = hash_read64(p + i - 16);
+			b = hash_read64(p + i - 8);
+		}
+		return hash_mum(hash_k1 ^ n, hash_mum(a ^ hash_k1, b ^ seed));
+	}
+
+	// [elements]
+
+	template<typename T>
+	constexpr bool is_hash_string_v = std::is_same_v<T, std::string_view> || is_std_string<T>::value;
+
+	// equal values have equal bytes: integers, enums, pointers, structs of those without padding
+	// (floating point is not: 0.0 == -0.0)
+	template<typename T>
+	constexpr bool is_hash_raw_v = std::has_unique_object_representations_v<T> && !is_hash_string_v<T>;
+
+	template<typename... Ts>
+	struct hash_plan : raw_run_plan<std::integer_sequence<bool, is_hash_raw_v<Ts>...>, Ts...> {};
+
+	template<typename Tuple, typename Indices = std::make_index_sequence<std::tuple_size_v<Tuple>>>
+	struct hash_plan_of;
+
+	template<typename Tuple, std::size_t... Is>
+	struct hash_plan_of<Tuple, std::index_sequence<Is...>>
+		: hash_plan<std::remove_cv_t<std::remove_reference_t<std::tuple_element_t<Is, Tuple>>>...> {};
+
+	template<typename Tuple, std::size_t I>
+	std::uint64_t hash_element(const Tuple& t, std::uint64_t seed) {
+		const auto& e = details::tuple_get<I>(t);
+		using T = std::remove_cv_t<std::remove_reference_t<decltype(e)>>;
+		if constexpr (is_hash_string_v<T>)
+			return hash_bytes(e.data(), e.size(), seed);
+		else
+			return hash_mum(seed ^ hash_k0, static_cast<std::uint64_t>(std::hash<T>{}(e)) ^ hash_k1);
+	}
+
+	// packs the elements of a raw run into 64-bit lanes and mixes two lanes per step,
+	// the elements are read in place (staging them in memory would stall store forwarding)
+	// all sizes are constants, so the lane bookkeeping folds away
+	class hash_lanes {
+	public:
+		explicit hash_lanes(std::uint64_t seed) noexcept : seed_{ seed } {}
+
+		template<typename T>
+		void push(const T& e) noexcept {
+			if constexpr (std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>) {
+				std::uint64_t v;
+				if constexpr (std::is_pointer_v<T>)
+					v = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(e));
+				else if constexpr (std::is_enum_v<T>)
+					v = static_cast<std::uint64_t>(static_cast<std::underlying_type_t<T>>(e));
+				else
+					v = static_cast<std::uint64_t>(e);
+				push_bits(v, sizeof(T) * 8);
+			}
+			else {
+				const char* p = reinterpret_cast<const char*>(&e);
+				for (std::size_t i = 0; i + 8 <= sizeof(T); i += 8)
+					push_bits(hash_read64(p + i), 64);
+				if constexpr (sizeof(T) % 8 != 0) {
+					std::uint64_t v = 0;
+					std::memcpy(&v, p + sizeof(T) / 8 * 8, sizeof(T) % 8);
+					push_bits(v, sizeof(T) % 8 * 8);
+				}
+			}
+		}
+
+		// one multiply per 16 bytes, the run size is fixed by the type so it is not mixed in
+		std::uint64_t finish() noexcept {
+			flush_word();
+			return has_lane_ ? hash_mum(lane_ ^ hash_k1, seed_ ^ hash_k2) : seed_;
+		}
+
+	private:
+		void push_bits(std::uint64_t v, std::size_t bits) noexcept {
+			if (bits_ + bits > 64)
+				flush_word();
+			// bits_ == 0 if bits == 64; signed values are sign-extended, keep their own bits only
+			word_ |= (bits == 64 ? v : v & ((std::uint64_t{ 1 } << bits) - 1)) << bits_;
+			bits_ += bits;
+		}
+
+		void flush_word() noexcept {
+			if (bits_ == 0)
+				return;
+			if (has_lane_)
+				seed_ = hash_mum(lane_ ^ hash_k1, word_ ^ seed_);
+			else
+				lane_ = word_;
+			has_lane_ = !has_lane_;
+			word_ = 0;
+			bits_ = 0;
+		}
+
+		std::uint64_t seed_;
+		std::uint64_t lane_{ 0 };
+		std::uint64_t word_{ 0 };
+		std::size_t bits_{ 0 };
+		bool has_lane_{ false };
+	};
+
+	template<typename Tuple, std::size_t... Is>
+	std::uint64_t hash_raw_run(const Tuple& t, std::uint64_t seed, std::index_sequence<Is...>) noexcept {
+		hash_lanes lanes{ seed };
+		(lanes.push(details::tuple_get<Is>(t)), ...);
+		return lanes.finish();
+	}
+
+	template<typename Tuple, std::size_t K>
+	std::uint64_t hash_run_at(const Tuple& t, std::uint64_t seed) {
+		constexpr raw_run run = hash_plan_of<Tuple>::runs[K];
+		constexpr auto indices = offset_sequence<run.begin>(std::make_index_sequence<run.end - run.begin>{});
+		if constexpr (run.raw)
+			return hash_raw_run(t, seed, indices);
+		else
+			return hash_element<Tuple, run.begin>(t, seed);
+	}
+
+	template<typename Tuple, std::size_t... Ks>
+	std::uint64_t tuple_hash(const Tuple& t, std::index_sequence<Ks...>) {
+		std::uint64_t seed = hash_k0;
+		((seed = hash_run_at<Tuple, Ks>(t, seed)), ...);
+		return seed;
+	}
+
+	template<typename L, typename R, std::size_t... Is>
+	constexpr bool tuple_equal(const L& lhs, const R& rhs, std::index_sequence<Is...>) {
+		return ((details::tuple_get<Is>(lhs) == details::tuple_get<Is>(rhs)) && ...);
+	}
+}
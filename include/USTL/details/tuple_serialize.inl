@@ -0,0 +1,325 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Ubpa::USTL {
+	enum class serialize_format {
+		raw,    // integers as their object representation
+		varint  // integers wider than a byte as LEB128 (zigzag if signed)
+	};
+}
+
+namespace Ubpa::USTL::details {
+	template<typename T> struct is_std_vector : std::false_type {};
+	template<typename T, typename A> struct is_std_vector<std::vector<T, A>> : std::true_type {};
+
+	// vector<bool> is not
+	template<typename T> struct is_trivial_vector : std::false_type {};
+	template<typename T, typename A> struct is_trivial_vector<std::vector<T, A>>
+		: std::bool_constant<std::is_trivially_copyable_v<T> && !std::is_same_v<T, bool>> {};
+
+	template<typename T> struct is_std_string : std::false_type {};
+	template<typename Traits, typename A> struct is_std_string<std::basic_string<char, Traits, A>> : std::true_type {};
+
+	template<typename T, serialize_format Format>
+	constexpr bool is_varint_v = Format == serialize_format::varint
+		&& std::is_integral_v<T> && !std::is_same_v<T, bool> && (sizeof(T) > 1);
+
+	// copied byte for byte, size known at compile time
+	template<typename T, serialize_format Format>
+	constexpr bool is_raw_v = std::is_trivially_copyable_v<T> && !std::is_same_v<T, std::string_view>
+		&& !is_varint_v<T, Format>;
+
+	template<typename T>
+	constexpr bool is_serializable_v = (std::is_trivially_copyable_v<T> && !std::is_pointer_v<T>) || is_std_string<T>::value
+		|| std::is_same_v<T, std::string_view>
+		|| is_trivial_vector<T>::value;
+
+	// [varint]
+
+	constexpr std::size_t varint_size(std::uint64_t v) noexcept {
+		std::size_t n = 1;
+		for (; v >= 0x80; v >>= 7)
+			n++;
+		return n;
+	}
+
+	inline char* write_varint(char* out, std::uint64_t v) noexcept {
+		for (; v >= 0x80; v >>= 7)
+			*out++ = static_cast<char>(static_cast<unsigned char>(v) | 0x80);
+		*out++ = static_cast<char>(v);
+		return out;
+	}
+
+	// nullptr if truncated or longer than 10 bytes
+	inline const char* read_varint(const char* first, const char* last, std::uint64_t& v) noexcept {
+		v = 0;
+		for (unsigned shift = 0; first != last && shift < 64; shift += 7) {
+			const auto byte = static_cast<unsigned char>(*first++);
+			v |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+			if ((byte & 0x80) == 0)
+				return first;
+		}
+		return nullptr;
+	}
+
+	template<typename T>
+	constexpr std::uint64_t zigzag_encode(T v) noexcept {
+		if constexpr (std::is_signed_v<T>) {
+			const auto u = static_cast<std::uint64_t>(static_cast<std::int64_t>(v));
+			return (u << 1) ^ (v < 0 ? ~std::uint64_t{ 0 } : 0);
+		}
+		else
+			return static_cast<std::uint64_t>(v);
+	}
+
+	template<typename T>
+	constexpr T zigzag_decode(std::uint64_t u) noexcept {
+		if constexpr (std::is_signed_v<T>)
+			return static_cast<T>(static_cast<std::int64_t>((u >> 1) ^ (~(u & 1) + 1)));
+		else
+			return static_cast<T>(u);
+	}
+
+	template<typename Tuple, typename Indices = std::make_index_sequence<std::tuple_size_v<Tuple>>>
+	struct is_serializable_tuple;
+	template<typename Tuple, std::size_t... Is>
+	struct is_serializable_tuple<Tuple, std::index_sequence<Is...>>
+		: std::bool_constant<(is_serializable_v<std::tuple_element_t<Is, Tuple>> && ...)> {};
+
+	// [runs]
+	// maximal ranges of adjacent raw elements, the other elements are runs of their own
+
+	struct raw_run {
+		std::size_t begin;
+		std::size_t end;
+		bool raw;
+		std::size_t size; // bytes, if raw
+	};
+
+	template<typename RawFlags, typename... Ts>
+	struct raw_run_plan;
+
+	template<bool... Raw, typename... Ts>
+	struct raw_run_plan<std::integer_sequence<bool, Raw...>, Ts...> {
+		static constexpr bool raw[] = { Raw..., false };
+		static constexpr std::size_t sizes[] = { sizeof(Ts)..., 0 };
+		static constexpr std::size_t N = sizeof...(Ts);
+
+		static constexpr std::size_t run_count = [] {
+			std::size_t n = 0;
+			for (std::size_t i = 0; i < N; i++)
+				n += !raw[i] || i == 0 || !raw[i - 1];
+			return n;
+		}();
+
+		static constexpr auto runs = [] {
+			std::array<raw_run, run_count> rst{};
+			std::size_t k = 0;
+			for (std::size_t i = 0; i < N; k++) {
+				rst[k] = { i, i + 1, raw[i], sizes[i] };
+				if (raw[i]) {
+					while (rst[k].end < N && raw[rst[k].end])
+						rst[k].size += sizes[rst[k].end++];
+				}
+				i = rst[k].end;
+			}
+			return rst;
+		}();
+
+		// bytes of the raw elements, a lower bound of the serialized size
+		static constexpr std::size_t raw_size = [] {
+			std::size_t n = 0;
+			for (const auto& run : runs)
+				n += run.raw ? run.size : 0;
+			return n;
+		}();
+	};
+
+	template<serialize_format Format, typename... Ts>
+	struct serialize_plan : raw_run_plan<std::integer_sequence<bool, is_raw_v<Ts, Format>...>, Ts...> {};
+
+	template<serialize_format Format, typename Tuple, typename Indices = std::make_index_sequence<std::tuple_size_v<Tuple>>>
+	struct serialize_plan_of;
+
+	template<serialize_format Format, typename Tuple, std::size_t... Is>
+	struct serialize_plan_of<Format, Tuple, std::index_sequence<Is...>>
+		: serialize_plan<Format, std::tuple_element_t<Is, Tuple>...> {};
+
+	// [single non-raw element]
+
+	template<serialize_format Format, typename T>
+	std::size_t element_serialized_size(const T& e) noexcept {
+		if constexpr (is_varint_v<T, Format>)
+			return varint_size(zigzag_encode(e));
+		else if constexpr (is_std_vector<T>::value)
+			return varint_size(e.size()) + e.size() * sizeof(typename T::value_type);
+		else // strings
+			return varint_size(e.size()) + e.size();
+	}
+
+	template<serialize_format Format, typename T>
+	char* serialize_element(char* out, const T& e) noexcept {
+		if constexpr (is_varint_v<T, Format>)
+			return write_varint(out, zigzag_encode(e));
+		else {
+			const std::size_t bytes = e.size() * sizeof(*e.data());
+			out = write_varint(out, e.size());
+			if (bytes != 0)
+				std::memcpy(out, e.data(), bytes);
+			return out + bytes;
+		}
+	}
+
+	// std::string_view points into [first, last), the zero-copy mode
+	template<serialize_format Format, typename T>
+	const char* deserialize_element(const char* first, const char* last, T& e) {
+		std::uint64_t v;
+		first = read_varint(first, last, v);
+		if (!first)
+			return nullptr;
+		if constexpr (is_varint_v<T, Format>) {
+			const T value = zigzag_decode<T>(v);
+			if (zigzag_encode(value) != v) // out of T's range
+				return nullptr;
+			e = value;
+			return first;
+		}
+		else {
+			using Elem = std::remove_const_t<std::remove_pointer_t<decltype(e.data())>>;
+			if (v > static_cast<std::uint64_t>(last - first) / sizeof(Elem))
+				return nullptr;
+			const auto n = static_cast<std::size_t>(v);
+			if constexpr (std::is_same_v<T, std::string_view>)
+				e = { first, n };
+			else {
+				e.resize(n);
+				if (n != 0)
+					std::memcpy(e.data(), first, n * sizeof(Elem));
+			}
+			return first + n * sizeof(Elem);
+		}
+	}
+
+	// [tuple]
+
+	template<typename Tuple, std::size_t... Is>
+	char* copy_raw_run(char* out, const Tuple& t, std::index_sequence<Is...>) noexcept {
+		// constant-size copies into one contiguous block, the compiler turns each into plain moves
+		((std::memcpy(out, &details::tuple_get<Is>(t), sizeof(details::tuple_get<Is>(t))), out += sizeof(details::tuple_get<Is>(t))), ...);
+		return out;
+	}
+
+	template<typename Tuple, std::size_t... Is>
+	const char* deserialize_raw_run(const char* first, Tuple& t, std::index_sequence<Is...>) noexcept {
+		((std::memcpy(&details::tuple_get<Is>(t), first, sizeof(details::tuple_get<Is>(t))), first += sizeof(details::tuple_get<Is>(t))), ...);
+		return first;
+	}
+
+	template<std::size_t Begin, std::size_t... Is>
+	constexpr auto offset_sequence(std::index_sequence<Is...>) noexcept {
+		return std::index_sequence<Begin + Is...>{};
+	}
+
+	template<serialize_format Format, typename Tuple, std::size_t K>
+	char* serialize_run_at(char* out, const Tuple& t) noexcept {
+		constexpr raw_run run = serialize_plan_of<Format, Tuple>::runs[K];
+		if constexpr (run.raw)
+			return copy_raw_run(out, t, offset_sequence<run.begin>(std::make_index_sequence<run.end - run.begin>{}));
+		else
+			return serialize_element<Format>(out, details::tuple_get<run.begin>(t));
+	}
+
+	template<serialize_format Format, typename Tuple, std::size_t K>
+	const char* deserialize_run_at(const char* first, const char* last, Tuple& t) {
+		constexpr raw_run run = serialize_plan_of<Format, Tuple>::runs[K];
+		if constexpr (run.raw) {
+			// one bounds check for the whole run
+			if (static_cast<std::size_t>(last - first) < run.size)
+				return nullptr;
+			return deserialize_raw_run(first, t, offset_sequence<run.begin>(std::make_index_sequence<run.end - run.begin>{}));
+		}
+		else
+			return deserialize_element<Format>(first, last, details::tuple_get<run.begin>(t));
+	}
+
+	template<serialize_format Format, typename Tuple, std::size_t... Ks>
+	std::size_t tuple_serialized_size(const Tuple& t, std::index_sequence<Ks...>) noexcept {
+		constexpr auto& runs = serialize_plan_of<Format, Tuple>::runs;
+		return serialize_plan_of<Format, Tuple>::raw_size
+			+ (std::size_t{ 0 } + ... + [&] {
+				if constexpr (runs[Ks].raw)
+					return std::size_t{ 0 };
+				else
+					return element_serialized_size<Format>(details::tuple_get<runs[Ks].begin>(t));
+			}());
+	}
+
+	template<serialize_format Format, typename Tuple, std::size_t... Ks>
+	char* tuple_serialize(char* out, const Tuple& t, std::index_sequence<Ks...>) noexcept {
+		((out = serialize_run_at<Format, Tuple, Ks>(out, t)), ...);
+		return out;
+	}
+
+	template<serialize_format Format, typename Tuple, std::size_t... Ks>
+	const char* tuple_deserialize(const char* first, [[maybe_unused]] const char* last, Tuple& t, std::index_sequence<Ks...>) {
+		((first = first ? deserialize_run_at<Format, Tuple, Ks>(first, last, t) : nullptr), ...);
+		return first;
+	}
+
+	template<typename Sink, typename Tuple, std::size_t... Is>
+	void write_raw_elements(Sink& sink, const Tuple& t, std::index_sequence<Is...>) {
+		(sink.write({ reinterpret_cast<const char*>(&details::tuple_get<Is>(t)), sizeof(details::tuple_get<Is>(t)) }), ...);
+	}
+
+	// runs are staged on the stack and handed to the sink in one write
+	template<serialize_format Format, typename Sink, typename Tuple, std::size_t K>
+	void serialize_run_to(Sink& sink, const Tuple& t) {
+		constexpr raw_run run = serialize_plan_of<Format, Tuple>::runs[K];
+		constexpr auto indices = offset_sequence<run.begin>(std::make_index_sequence<run.end - run.begin>{});
+		if constexpr (run.raw && run.size <= 256) {
+			char buffer[run.size];
+			copy_raw_run(buffer, t, indices);
+			sink.write({ buffer, run.size });
+		}
+		else if constexpr (run.raw)
+			write_raw_elements(sink, t, indices);
+		else {
+			const auto& e = details::tuple_get<run.begin>(t);
+			char buffer[10];
+			if constexpr (is_varint_v<std::decay_t<decltype(e)>, Format>)
+				sink.write({ buffer, static_cast<std::size_t>(write_varint(buffer, zigzag_encode(e)) - buffer) });
+			else {
+				sink.write({ buffer, static_cast<std::size_t>(write_varint(buffer, e.size()) - buffer) });
+				sink.write({ reinterpret_cast<const char*>(e.data()), e.size() * sizeof(*e.data()) });
+			}
+		}
+	}
+
+	template<serialize_format Format, typename Sink, typename Tuple, std::size_t... Ks>
+	void tuple_serialize_to(Sink& sink, const Tuple& t, std::index_sequence<Ks...>) {
+		(serialize_run_to<Format, Sink, Tuple, Ks>(sink, t), ...);
+	}
+
+	// std::string -> std::string_view, the rest unchanged
+	template<typename T>
+	struct serialize_view { using type = T; };
+	template<typename Traits, typename A>
+	struct serialize_view<std::basic_string<char, Traits, A>> { using type = std::string_view; };
+
+	template<typename Tuple, typename Indices = std::make_index_sequence<std::tuple_size_v<Tuple>>>
+	struct tuple_deserialize_view;
+	template<typename Tuple, std::size_t... Is>
+	struct tuple_deserialize_view<Tuple, std::index_sequence<Is...>> {
+		using type = std::tuple<typename serialize_view<std::tuple_element_t<Is, Tuple>>::type...>;
+	};
+}
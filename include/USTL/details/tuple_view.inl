@@ -0,0 +1,38 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+namespace Ubpa::USTL::details {
+	// element I of a concatenation: (index of the tuple, index inside it)
+	template<typename... Tuples>
+	struct tuple_concat_indices {
+		static constexpr std::size_t sizes[] = { std::tuple_size_v<std::remove_reference_t<Tuples>>..., 0 };
+		static constexpr std::size_t size = (std::tuple_size_v<std::remove_reference_t<Tuples>> + ... + 0);
+
+		static constexpr std::size_t outer(std::size_t i) noexcept {
+			std::size_t j = 0;
+			while (i >= sizes[j]) {
+				i -= sizes[j];
+				j++;
+			}
+			return j;
+		}
+
+		static constexpr std::size_t inner(std::size_t i) noexcept {
+			std::size_t j = 0;
+			while (i >= sizes[j]) {
+				i -= sizes[j];
+				j++;
+			}
+			return i;
+		}
+	};
+
+	// a view keeps lvalue tuples by reference and rvalue tuples by value
+	// so a view of a temporary (or of another view) does not dangle
+	template<typename T>
+	using tuple_view_base_t = std::conditional_t<std::is_lvalue_reference_v<T>, T, std::remove_cv_t<std::remove_reference_t<T>>>;
+}
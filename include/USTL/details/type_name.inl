@@ -0,0 +1,114 @@
+#pragma once
+
+#include <array>
+#include <string_view>
+
+namespace Ubpa::USTL::details {
+	template<typename T>
+	constexpr std::string_view raw_type_name() noexcept {
+#if defined(__clang__) || defined(__GNUC__)
+		return __PRETTY_FUNCTION__;
+#elif defined(_MSC_VER)
+		return __FUNCSIG__;
+#else
+		static_assert(sizeof(T) == 0, "type_name requires __PRETTY_FUNCTION__ or __FUNCSIG__.");
+#endif
+	}
+
+	// the probe type locates where T is printed inside raw_type_name
+	constexpr std::string_view type_name_probe = "double";
+	constexpr std::size_t type_name_prefix = raw_type_name<double>().find(type_name_probe);
+	constexpr std::size_t type_name_suffix = raw_type_name<double>().size() - type_name_prefix - type_name_probe.size();
+
+	template<typename T>
+	constexpr std::string_view raw_type_name_of() noexcept {
+		constexpr std::string_view raw = raw_type_name<T>();
+		return raw.substr(type_name_prefix, raw.size() - type_name_prefix - type_name_suffix);
+	}
+
+	constexpr bool is_identifier_char(char c) noexcept {
+		return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') || ('0' <= c && c <= '9') || c == '_';
+	}
+
+	struct type_name_rule {
+		std::string_view from;
+		std::string_view to;
+	};
+
+	// spellings which differ across GCC, Clang and MSVC, normalized to Clang's
+	constexpr type_name_rule type_name_rules[] = {
+		{ "class ", "" },
+		{ "struct ", "" },
+		{ "enum ", "" },
+		{ "union ", "" },
+		{ "__cxx11::", "" },
+		{ "__1::", "" },
+		{ "{anonymous}", "(anonymous namespace)" },
+		{ "`anonymous namespace'", "(anonymous namespace)" },
+		{ "long long unsigned int", "unsigned long long" },
+		{ "long long int", "long long" },
+		{ "long unsigned int", "unsigned long" },
+		{ "long int", "long" },
+		{ "short unsigned int", "unsigned short" },
+		{ "short int", "short" },
+		{ "unsigned __int64", "unsigned long long" },
+		{ "__int64", "long long" },
+	};
+
+	// writes the normalized name to out (if not nullptr) and returns its size
+	// - rules only match at token boundaries
+	// - a space is kept only between two identifier characters
+	constexpr std::size_t normalize_type_name(std::string_view in, char* out) noexcept {
+		std::size_t n = 0;
+		char last = '\0';
+		const auto emit = [&](char c) {
+			if (out)
+				out[n] = c;
+			n++;
+			last = c;
+		};
+
+		std::size_t i = 0;
+		while (i < in.size()) {
+			bool replaced = false;
+			if (i == 0 || !is_identifier_char(in[i - 1])) {
+				for (const auto& rule : type_name_rules) {
+					if (in.substr(i, rule.from.size()) != rule.from)
+						continue;
+					const std::size_t next = i + rule.from.size();
+					if (is_identifier_char(rule.from.back()) && next < in.size() && is_identifier_char(in[next]))
+						continue;
+					if (is_identifier_char(last) && !rule.to.empty() && is_identifier_char(rule.to.front()))
+						emit(' ');
+					for (const auto c : rule.to)
+						emit(c);
+					i = next;
+					replaced = true;
+					break;
+				}
+			}
+			if (replaced)
+				continue;
+
+			const char c = in[i++];
+			if (c == ' ') {
+				if (is_identifier_char(last) && i < in.size() && is_identifier_char(in[i]))
+					emit(' ');
+			}
+			else
+				emit(c);
+		}
+		return n;
+	}
+
+	template<typename T>
+	struct type_name_storage {
+		static constexpr std::size_t size = normalize_type_name(raw_type_name_of<T>(), nullptr);
+
+		static constexpr std::array<char, size + 1> chars = [] {
+			std::array<char, size + 1> chars{};
+			normalize_type_name(raw_type_name_of<T>(), chars.data());
+			return chars;
+		}();
+	};
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace Ubpa::USTL::details {
+	constexpr bool is_utf8_continuation(unsigned char c) noexcept { return (c & 0xC0) == 0x80; }
+
+	// length of the well-formed sequence starting at str[i], 0 if ill-formed
+	// rejects overlong forms, surrogates and code points above U+10FFFF
+	template<typename Char>
+	constexpr std::size_t utf8_sequence(std::basic_string_view<Char> str, std::size_t i) noexcept {
+		const auto at = [&](std::size_t k) { return static_cast<unsigned char>(str[i + k]); };
+		const unsigned char b0 = at(0);
+		const std::size_t left = str.size() - i;
+		if (b0 < 0x80)
+			return 1;
+		if (b0 < 0xC2)
+			return 0;
+		if (b0 < 0xE0)
+			return left >= 2 && is_utf8_continuation(at(1)) ? 2 : 0;
+		if (b0 < 0xF0) {
+			if (left < 3)
+				return 0;
+			const unsigned char lo = b0 == 0xE0 ? 0xA0 : 0x80;
+			const unsigned char hi = b0 == 0xED ? 0x9F : 0xBF;
+			return lo <= at(1) && at(1) <= hi && is_utf8_continuation(at(2)) ? 3 : 0;
+		}
+		if (b0 < 0xF5) {
+			if (left < 4)
+				return 0;
+			const unsigned char lo = b0 == 0xF0 ? 0x90 : 0x80;
+			const unsigned char hi = b0 == 0xF4 ? 0x8F : 0xBF;
+			return lo <= at(1) && at(1) <= hi && is_utf8_continuation(at(2)) && is_utf8_continuation(at(3)) ? 4 : 0;
+		}
+		return 0;
+	}
+
+	template<typename Char>
+	constexpr bool utf8_validate(std::basic_string_view<Char> str) noexcept {
+		for (std::size_t i = 0; i < str.size();) {
+			const std::size_t n = utf8_sequence(str, i);
+			if (n == 0)
+				return false;
+			i += n;
+		}
+		return true;
+	}
+
+	template<typename Char>
+	constexpr std::size_t utf8_length(std::basic_string_view<Char> str) noexcept {
+		std::size_t n = 0;
+		for (const auto c : str)
+			n += !is_utf8_continuation(static_cast<unsigned char>(c));
+		return n;
+	}
+
+	// skips ASCII blocks with SIMD, validates the other sequences one by one
+	inline bool simd_utf8_validate(const char* data, std::size_t size) noexcept {
+		const std::string_view str{ data, size };
+		std::size_t i = 0;
+		while (i < size) {
+#if USTL_AVX2
+			for (; i + 32 <= size; i += 32) {
+				const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+				const auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(block));
+				if (mask != 0) {
+					i += countr_zero(mask);
+					break;
+				}
+			}
+#endif
+#if USTL_SSE2
+			for (; i + 16 <= size; i += 16) {
+				const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+				const auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(block));
+				if (mask != 0) {
+					i += countr_zero(mask);
+					break;
+				}
+			}
+#endif
+			if (i == size)
+				break;
+			const std::size_t n = utf8_sequence(str, i);
+			if (n == 0)
+				return false;
+			i += n;
+		}
+		return true;
+	}
+
+	// counts the bytes that are not continuation bytes (0x80-0xBF)
+	inline std::size_t simd_utf8_length(const char* data, std::size_t size) noexcept {
+		std::size_t n = 0;
+		std::size_t i = 0;
+#if USTL_SSE2
+		// as signed bytes, continuation bytes are [-128, -65]
+		const __m128i threshold = _mm_set1_epi8(-65);
+		for (; i + 16 <= size; i += 16) {
+			const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+			n += popcount(static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(block, threshold))));
+		}
+#endif
+		for (; i < size; i++)
+			n += !is_utf8_continuation(static_cast<unsigned char>(data[i]));
+		return n;
+	}
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "type_name.h"
+
+#include <array>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+namespace Ubpa::USTL {
+	namespace details {
+		// E{ U{} } only compiles if E has a fixed underlying type (always true for enum class)
+		template<typename E, typename = void>
+		struct enum_is_fixed : std::false_type {};
+		template<typename E>
+		struct enum_is_fixed<E, std::void_t<decltype(E{ std::underlying_type_t<E>{} })>> : std::true_type {};
+	}
+
+	// probed range of enum values, specialize it for enums outside [-128, 127]
+	// an enum without a fixed underlying type only has the values of its enumerators' bit width,
+	// casting anything else is not a constant expression, so its range must be specialized within those
+	template<typename E>
+	struct enum_range {
+		static_assert(std::is_enum_v<E>);
+		static_assert(details::enum_is_fixed<E>::value,
+			"enum_range: E has no fixed underlying type, specialize enum_range within its values.");
+		using U = std::underlying_type_t<E>;
+		static constexpr long long min = std::is_signed_v<U> ? -128 : 0;
+		static constexpr long long max = std::is_signed_v<U> ? 127
+			: (std::numeric_limits<U>::max() < 255 ? static_cast<long long>(std::numeric_limits<U>::max()) : 255);
+	};
+}
+
+#include "details/enum.inl"
+
+namespace Ubpa::USTL {
+	// name of the enumerator V as a cstring, e.g. enum_name<Color::Red> == "Red"
+	template<auto V>
+	constexpr auto enum_name = details::enum_name_<V>();
+
+	// number of named enumerators in enum_range<E>
+	template<typename E>
+	constexpr std::size_t enum_count = details::enum_count_<E>();
+
+	// named enumerators in ascending order
+	template<typename E>
+	constexpr std::array<E, enum_count<E>> enum_values = details::enum_values_<E>();
+
+	// names of enum_values<E>, in the same order
+	template<typename E>
+	constexpr std::array<std::string_view, enum_count<E>> enum_names = details::enum_names_<E>();
+
+	// runtime enum_name through a dense table, empty if value is not a named enumerator
+	template<typename E>
+	constexpr std::string_view enum_name_of(E value) noexcept {
+		const auto i = static_cast<long long>(value) - enum_range<E>::min;
+		if (i < 0 || i >= static_cast<long long>(details::enum_dense_names<E>.size()))
+			return {};
+		return details::enum_dense_names<E>[static_cast<std::size_t>(i)];
+	}
+
+	// name -> enumerator through a compile-time perfect hash
+	template<typename E>
+	constexpr std::optional<E> enum_cast(std::string_view name) noexcept {
+		constexpr auto table = details::enum_hash_table_<E>();
+		const std::size_t slot = table.slots[details::enum_hash(name, table.seed) & (table.slots.size() - 1)];
+		if (slot == 0 || enum_names<E>[slot - 1] != name)
+			return std::nullopt;
+		return enum_values<E>[slot - 1];
+	}
+}
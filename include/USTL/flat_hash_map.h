@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "details/flat_hash_map.inl"
+
+namespace Ubpa::USTL {
+	// open addressing hash map (Swiss table): a control byte per slot, probed 16 at a time with SSE2
+	// - the elements live in one flat array, a lookup is a group match then a key compare, no node chasing
+	// - stateless Hash / KeyEqual / Alloc take no space (compress_pair)
+	// - the hash is mixed before use, identity hashes (std::hash of pointers, integers) are fine
+	// - transparent Hash and KeyEqual enable heterogeneous find / contains / count
+	// insert and rehash invalidate iterators and references, erase only the erased ones;
+	// a rehash copies the elements if their move may throw, so a throw leaves the table unchanged;
+	// move-only elements with a throwing move only get the basic guarantee (the table may lose elements)
+	// otherwise it follows std::unordered_map
+	template<typename Key, typename T, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>,
+		typename Alloc = std::allocator<std::pair<const Key, T>>>
+	class flat_hash_map : public details::flat_hash_table<details::flat_map_policy<Key, T>, Hash, KeyEqual, Alloc> {
+		using base = details::flat_hash_table<details::flat_map_policy<Key, T>, Hash, KeyEqual, Alloc>;
+		template<typename K>
+		static constexpr bool is_key_v = std::is_same_v<std::remove_cv_t<std::remove_reference_t<K>>, Key>;
+	public:
+		using mapped_type = T;
+		using typename base::key_type;
+		using typename base::value_type;
+		using typename base::iterator;
+		using typename base::const_iterator;
+
+		using base::base;
+		using base::insert;
+
+		template<typename P, std::enable_if_t<std::is_constructible_v<value_type, P&&>, int> = 0>
+		std::pair<iterator, bool> insert(P&& value) { return this->emplace(std::forward<P>(value)); }
+
+		// K is key_type, a non-const lvalue is forwarded as is (keys like shared_object only copy from those)
+		template<typename K, typename... Args, std::enable_if_t<is_key_v<K>, int> = 0>
+		std::pair<iterator, bool> try_emplace(K&& key, Args&&... args) {
+			return this->emplace_key(key, std::piecewise_construct,
+				std::forward_as_tuple(std::forward<K>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+		}
+
+		template<typename K, typename M, std::enable_if_t<is_key_v<K>, int> = 0>
+		std::pair<iterator, bool> insert_or_assign(K&& key, M&& obj) {
+			auto rst = try_emplace(std::forward<K>(key), std::forward<M>(obj));
+			if (!rst.second)
+				rst.first->second = std::forward<M>(obj);
+			return rst;
+		}
+
+		template<typename K, std::enable_if_t<is_key_v<K>, int> = 0>
+		T& operator[](K&& key) { return try_emplace(std::forward<K>(key)).first->second; }
+
+		// anything convertible to key_type
+		T& operator[](Key&& key) { return try_emplace(std::move(key)).first->second; }
+
+		T& at(const Key& key) {
+			const auto target = this->find(key);
+			if (target == this->end())
+				throw std::out_of_range{ "flat_hash_map::at" };
+			return target->second;
+		}
+
+		const T& at(const Key& key) const {
+			const auto target = this->find(key);
+			if (target == this->end())
+				throw std::out_of_range{ "flat_hash_map::at" };
+			return target->second;
+		}
+	};
+
+	// flat_hash_map without mapped values, the elements are only reachable as const
+	template<typename Key, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>,
+		typename Alloc = std::allocator<Key>>
+	class flat_hash_set : public details::flat_hash_table<details::flat_set_policy<Key>, Hash, KeyEqual, Alloc> {
+		using base = details::flat_hash_table<details::flat_set_policy<Key>, Hash, KeyEqual, Alloc>;
+	public:
+		using base::base;
+	};
+
+	template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+	void swap(flat_hash_map<Key, T, Hash, KeyEqual, Alloc>& lhs, flat_hash_map<Key, T, Hash, KeyEqual, Alloc>& rhs)
+		noexcept(noexcept(lhs.swap(rhs)))
+	{
+		lhs.swap(rhs);
+	}
+
+	template<typename Key, typename Hash, typename KeyEqual, typename Alloc>
+	void swap(flat_hash_set<Key, Hash, KeyEqual, Alloc>& lhs, flat_hash_set<Key, Hash, KeyEqual, Alloc>& rhs)
+		noexcept(noexcept(lhs.swap(rhs)))
+	{
+		lhs.swap(rhs);
+	}
+}
@@ -595,319 +595,322 @@ namespace Ubpa::USTL {
 
 template<typename T>
 struct std::hash<Ubpa::USTL::shared_object<T>> {
-    constexpr std::size_t operator()(const Ubpa::USTL::shared_object<T>& obj) noexcept {
-        return std::hash<typename std::shared_ptr<T>::element_type*>()(obj.get());
+    std::size_t operator()(const Ubpa::USTL::shared_object<T>& obj) const noexcept {
+        return std::hash<decltype(obj.get())>()(obj.get());
     }
 };
 
 template<typename T, typename Deleter>
 struct std::hash<Ubpa::USTL::unique_object<T, Deleter>> {
-    constexpr std::size_t operator()(const Ubpa::USTL::unique_object<T, Deleter>& obj) noexcept {
-        return std::hash<typename std::unique_ptr<T, Deleter>::pointer>()(obj.get());
+    std::size_t operator()(const Ubpa::USTL::unique_object<T, Deleter>& obj) const noexcept {
+        return std::hash<decltype(obj.get())>()(obj.get());
     }
 };
 
 // Compare
 ////////////
 
-template<typename Ty1, typename Ty2>
-bool operator==(const Ubpa::USTL::shared_object<Ty1>& left, const Ubpa::USTL::shared_object<Ty2>& right) noexcept {
-    return left.get() == right.get();
-}
+// operands are USTL types, so ADL finds these from any namespace (std::equal_to, std::less, ...)
+namespace Ubpa::USTL {
+    template<typename Ty1, typename Ty2>
+    bool operator==(const Ubpa::USTL::shared_object<Ty1>& left, const Ubpa::USTL::shared_object<Ty2>& right) noexcept {
+        return left.get() == right.get();
+    }
 
-template<typename Ty1, typename Ty2>
-bool operator!=(const Ubpa::USTL::shared_object<Ty1>& left, const Ubpa::USTL::shared_object<Ty2>& right) noexcept {
-    return left.get() != right.get();
-}
+    template<typename Ty1, typename Ty2>
+    bool operator!=(const Ubpa::USTL::shared_object<Ty1>& left, const Ubpa::USTL::shared_object<Ty2>& right) noexcept {
+        return left.get() != right.get();
+    }
 
-template<typename Ty1, typename Ty2>
-bool operator<(const Ubpa::USTL::shared_object<Ty1>& left, const Ubpa::USTL::shared_object<Ty2>& right) noexcept {
-    return left.get() < right.get();
-}
+    template<typename Ty1, typename Ty2>
+    bool operator<(const Ubpa::USTL::shared_object<Ty1>& left, const Ubpa::USTL::shared_object<Ty2>& right) noexcept {
+        return left.get() < right.get();
+    }
 
-template<typename Ty1, typename Ty2>
-bool operator>=(const Ubpa::USTL::shared_object<Ty1>& left, const Ubpa::USTL::shared_object<Ty2>& right) noexcept {
-    return left.get() >= right.get();
-}
+    template<typename Ty1, typename Ty2>
+    bool operator>=(const Ubpa::USTL::shared_object<Ty1>& left, const Ubpa::USTL::shared_object<Ty2>& right) noexcept {
+        return left.get() >= right.get();
+    }
 
-template<typename Ty1, typename Ty2>
-bool operator>(const Ubpa::USTL::shared_object<Ty1>& left, const Ubpa::USTL::shared_object<Ty2>& right) noexcept {
-    return left.get() > right.get();
-}
+    template<typename Ty1, typename Ty2>
+    bool operator>(const Ubpa::USTL::shared_object<Ty1>& left, const Ubpa::USTL::shared_object<Ty2>& right) noexcept {
+        return left.get() > right.get();
+    }
 
-template<typename Ty1, typename Ty2>
-bool operator<=(const Ubpa::USTL::shared_object<Ty1>& left, const Ubpa::USTL::shared_object<Ty2>& right) noexcept {
-    return left.get() <= right.get();
-}
+    template<typename Ty1, typename Ty2>
+    bool operator<=(const Ubpa::USTL::shared_object<Ty1>& left, const Ubpa::USTL::shared_object<Ty2>& right) noexcept {
+        return left.get() <= right.get();
+    }
 
-template<typename Ty1, typename Ty2>
-bool operator==(const std::shared_ptr<Ty1>& left, const Ubpa::USTL::shared_object<Ty2>& right) noexcept {
-    return left.get() == right.get();
-}
+    template<typename Ty1, typename Ty2>
+    bool operator==(const std::shared_ptr<Ty1>& left, const Ubpa::USTL::shared_object<Ty2>& right) noexcept {
+        return left.get() == right.get();
+    }
 
-template<typename Ty1, typename Ty2>
-bool operator!=(const std::shared_ptr<Ty1>& left, const Ubpa::USTL::shared_object<Ty2>& right) noexcept {
-    return left.get() != right.get();
-}
+    template<typename Ty1, typename Ty2>
+    bool operator!=(const std::shared_ptr<Ty1>& left, const Ubpa::USTL::shared_object<Ty2>& right) noexcept {
+        return left.get() != right.get();
+    }
 
-template<typename Ty1, typename Ty2>
-bool operator<(const std::shared_ptr<Ty1>& left, const Ubpa::USTL::shared_object<Ty2>& right) noexcept {
-    return left.get() < right.get();
-}
+    template<typename Ty1, typename Ty2>
+    bool operator<(const std::shared_ptr<Ty1>& left, const Ubpa::USTL::shared_object<Ty2>& right) noexcept {
+        return left.get() < right.get();
+    }
 
-template<typename Ty1, typename Ty2>
-bool operator>=(const std::shared_ptr<Ty1>& left, const Ubpa::USTL::shared_object<Ty2>& right) noexcept {
-    return left.get() >= right.get();
-}
+    template<typename Ty1, typename Ty2>
+    bool operator>=(const std::shared_ptr<Ty1>& left, const Ubpa::USTL::shared_object<Ty2>& right) noexcept {
+        return left.get() >= right.get();
+    }
 
-template<typename Ty1, typename Ty2>
-bool operator>(const std::shared_ptr<Ty1>& left, const Ubpa::USTL::shared_object<Ty2>& right) noexcept {
-    return left.get() > right.get();
-}
+    template<typename Ty1, typename Ty2>
+    bool operator>(const std::shared_ptr<Ty1>& left, const Ubpa::USTL::shared_object<Ty2>& right) noexcept {
+        return left.get() > right.get();
+    }
 
-template<typename Ty1, typename Ty2>
-bool operator<=(const std::shared_ptr<Ty1>& left, const Ubpa::USTL::shared_object<Ty2>& right) noexcept {
-    return left.get() <= right.get();
-}
+    template<typename Ty1, typename Ty2>
+    bool operator<=(const std::shared_ptr<Ty1>& left, const Ubpa::USTL::shared_object<Ty2>& right) noexcept {
+        return left.get() <= right.get();
+    }
 
-template<typename Ty1, typename Ty2>
-bool operator==(const Ubpa::USTL::shared_object<Ty1>& left, const std::shared_ptr<Ty2>& right) noexcept {
-    return left.get() == right.get();
-}
+    template<typename Ty1, typename Ty2>
+    bool operator==(const Ubpa::USTL::shared_object<Ty1>& left, const std::shared_ptr<Ty2>& right) noexcept {
+        return left.get() == right.get();
+    }
 
-template<typename Ty1, typename Ty2>
-bool operator!=(const Ubpa::USTL::shared_object<Ty1>& left, const std::shared_ptr<Ty2>& right) noexcept {
-    return left.get() != right.get();
-}
+    template<typename Ty1, typename Ty2>
+    bool operator!=(const Ubpa::USTL::shared_object<Ty1>& left, const std::shared_ptr<Ty2>& right) noexcept {
+        return left.get() != right.get();
+    }
 
-template<typename Ty1, typename Ty2>
-bool operator<(const Ubpa::USTL::shared_object<Ty1>& left, const std::shared_ptr<Ty2>& right) noexcept {
-    return left.get() < right.get();
-}
+    template<typename Ty1, typename Ty2>
+    bool operator<(const Ubpa::USTL::shared_object<Ty1>& left, const std::shared_ptr<Ty2>& right) noexcept {
+        return left.get() < right.get();
+    }
 
-template<typename Ty1, typename Ty2>
-bool operator>=(const Ubpa::USTL::shared_object<Ty1>& left, const std::shared_ptr<Ty2>& right) noexcept {
-    return left.get() >= right.get();
-}
+    template<typename Ty1, typename Ty2>
+    bool operator>=(const Ubpa::USTL::shared_object<Ty1>& left, const std::shared_ptr<Ty2>& right) noexcept {
+        return left.get() >= right.get();
+    }
 
-template<typename Ty1, typename Ty2>
-bool operator>(const Ubpa::USTL::shared_object<Ty1>& left, const std::shared_ptr<Ty2>& right) noexcept {
-    return left.get() > right.get();
-}
+    template<typename Ty1, typename Ty2>
+    bool operator>(const Ubpa::USTL::shared_object<Ty1>& left, const std::shared_ptr<Ty2>& right) noexcept {
+        return left.get() > right.get();
+    }
 
-template<typename Ty1, typename Ty2>
-bool operator<=(const Ubpa::USTL::shared_object<Ty1>& left, const std::shared_ptr<Ty2>& right) noexcept {
-    return left.get() <= right.get();
-}
+    template<typename Ty1, typename Ty2>
+    bool operator<=(const Ubpa::USTL::shared_object<Ty1>& left, const std::shared_ptr<Ty2>& right) noexcept {
+        return left.get() <= right.get();
+    }
 
-template <typename T>
-bool operator==(const Ubpa::USTL::shared_object<T>& left, std::nullptr_t) noexcept {
-    return left.get() == nullptr;
-}
+    template <typename T>
+    bool operator==(const Ubpa::USTL::shared_object<T>& left, std::nullptr_t) noexcept {
+        return left.get() == nullptr;
+    }
 
-template <typename T>
-bool operator==(std::nullptr_t, const Ubpa::USTL::shared_object<T>& right) noexcept {
-    return nullptr == right.get();
-}
+    template <typename T>
+    bool operator==(std::nullptr_t, const Ubpa::USTL::shared_object<T>& right) noexcept {
+        return nullptr == right.get();
+    }
 
-template <typename T>
-bool operator!=(const Ubpa::USTL::shared_object<T>& left, std::nullptr_t) noexcept {
-    return left.get() != nullptr;
-}
+    template <typename T>
+    bool operator!=(const Ubpa::USTL::shared_object<T>& left, std::nullptr_t) noexcept {
+        return left.get() != nullptr;
+    }
 
-template <typename T>
-bool operator!=(std::nullptr_t, const Ubpa::USTL::shared_object<T>& right) noexcept {
-    return nullptr != right.get();
-}
+    template <typename T>
+    bool operator!=(std::nullptr_t, const Ubpa::USTL::shared_object<T>& right) noexcept {
+        return nullptr != right.get();
+    }
 
-template <typename T>
-bool operator<(const Ubpa::USTL::shared_object<T>& left, std::nullptr_t) noexcept {
-    return left.get() < static_cast<typename Ubpa::USTL::shared_object<T>::element_type*>(nullptr);
-}
+    template <typename T>
+    bool operator<(const Ubpa::USTL::shared_object<T>& left, std::nullptr_t) noexcept {
+        return left.get() < static_cast<typename Ubpa::USTL::shared_object<T>::element_type*>(nullptr);
+    }
 
-template <typename T>
-bool operator<(std::nullptr_t, const Ubpa::USTL::shared_object<T>& right) noexcept {
-    return static_cast<typename Ubpa::USTL::shared_object<T>::element_type*>(nullptr) < right.get();
-}
+    template <typename T>
+    bool operator<(std::nullptr_t, const Ubpa::USTL::shared_object<T>& right) noexcept {
+        return static_cast<typename Ubpa::USTL::shared_object<T>::element_type*>(nullptr) < right.get();
+    }
 
-template <typename T>
-bool operator>=(const Ubpa::USTL::shared_object<T>& left, std::nullptr_t) noexcept {
-    return left.get() >= static_cast<typename Ubpa::USTL::shared_object<T>::element_type*>(nullptr);
-}
+    template <typename T>
+    bool operator>=(const Ubpa::USTL::shared_object<T>& left, std::nullptr_t) noexcept {
+        return left.get() >= static_cast<typename Ubpa::USTL::shared_object<T>::element_type*>(nullptr);
+    }
 
-template <typename T>
-bool operator>=(std::nullptr_t, const Ubpa::USTL::shared_object<T>& right) noexcept {
-    return static_cast<typename Ubpa::USTL::shared_object<T>::element_type*>(nullptr) >= right.get();
-}
+    template <typename T>
+    bool operator>=(std::nullptr_t, const Ubpa::USTL::shared_object<T>& right) noexcept {
+        return static_cast<typename Ubpa::USTL::shared_object<T>::element_type*>(nullptr) >= right.get();
+    }
 
-template <typename T>
-bool operator>(const Ubpa::USTL::shared_object<T>& left, std::nullptr_t) noexcept {
-    return left.get() > static_cast<typename Ubpa::USTL::shared_object<T>::element_type*>(nullptr);
-}
+    template <typename T>
+    bool operator>(const Ubpa::USTL::shared_object<T>& left, std::nullptr_t) noexcept {
+        return left.get() > static_cast<typename Ubpa::USTL::shared_object<T>::element_type*>(nullptr);
+    }
 
-template <typename T>
-bool operator>(std::nullptr_t, const Ubpa::USTL::shared_object<T>& right) noexcept {
-    return static_cast<typename Ubpa::USTL::shared_object<T>::element_type*>(nullptr) > right.get();
-}
+    template <typename T>
+    bool operator>(std::nullptr_t, const Ubpa::USTL::shared_object<T>& right) noexcept {
+        return static_cast<typename Ubpa::USTL::shared_object<T>::element_type*>(nullptr) > right.get();
+    }
 
-template <typename T>
-bool operator<=(const Ubpa::USTL::shared_object<T>& left, std::nullptr_t) noexcept {
-    return left.get() <= static_cast<typename Ubpa::USTL::shared_object<T>::element_type*>(nullptr);
-}
+    template <typename T>
+    bool operator<=(const Ubpa::USTL::shared_object<T>& left, std::nullptr_t) noexcept {
+        return left.get() <= static_cast<typename Ubpa::USTL::shared_object<T>::element_type*>(nullptr);
+    }
 
-template <typename T>
-bool operator<=(std::nullptr_t, const Ubpa::USTL::shared_object<T>& right) noexcept {
-    return static_cast<typename Ubpa::USTL::shared_object<T>::element_type*>(nullptr) <= right.get();
-}
+    template <typename T>
+    bool operator<=(std::nullptr_t, const Ubpa::USTL::shared_object<T>& right) noexcept {
+        return static_cast<typename Ubpa::USTL::shared_object<T>::element_type*>(nullptr) <= right.get();
+    }
 
-template<typename Ty1, typename D1, typename Ty2, typename D2>
-bool operator==(const Ubpa::USTL::unique_object<Ty1, D1>& left, const Ubpa::USTL::unique_object<Ty2, D2>& right) noexcept {
-    return left.get() == right.get();
-}
+    template<typename Ty1, typename D1, typename Ty2, typename D2>
+    bool operator==(const Ubpa::USTL::unique_object<Ty1, D1>& left, const Ubpa::USTL::unique_object<Ty2, D2>& right) noexcept {
+        return left.get() == right.get();
+    }
 
-template<typename Ty1, typename D1, typename Ty2, typename D2>
-bool operator!=(const Ubpa::USTL::unique_object<Ty1, D1>& left, const Ubpa::USTL::unique_object<Ty2, D2>& right) noexcept {
-    return left.get() != right.get();
-}
+    template<typename Ty1, typename D1, typename Ty2, typename D2>
+    bool operator!=(const Ubpa::USTL::unique_object<Ty1, D1>& left, const Ubpa::USTL::unique_object<Ty2, D2>& right) noexcept {
+        return left.get() != right.get();
+    }
 
-template<typename Ty1, typename D1, typename Ty2, typename D2>
-bool operator<(const Ubpa::USTL::unique_object<Ty1, D1>& left, const Ubpa::USTL::unique_object<Ty2, D2>& right) noexcept {
-    return left.get() < right.get();
-}
+    template<typename Ty1, typename D1, typename Ty2, typename D2>
+    bool operator<(const Ubpa::USTL::unique_object<Ty1, D1>& left, const Ubpa::USTL::unique_object<Ty2, D2>& right) noexcept {
+        return left.get() < right.get();
+    }
 
-template<typename Ty1, typename D1, typename Ty2, typename D2>
-bool operator>=(const Ubpa::USTL::unique_object<Ty1, D1>& left, const Ubpa::USTL::unique_object<Ty2, D2>& right) noexcept {
-    return left.get() >= right.get();
-}
+    template<typename Ty1, typename D1, typename Ty2, typename D2>
+    bool operator>=(const Ubpa::USTL::unique_object<Ty1, D1>& left, const Ubpa::USTL::unique_object<Ty2, D2>& right) noexcept {
+        return left.get() >= right.get();
+    }
 
-template<typename Ty1, typename D1, typename Ty2, typename D2>
-bool operator>(const Ubpa::USTL::unique_object<Ty1, D1>& left, const Ubpa::USTL::unique_object<Ty2, D2>& right) noexcept {
-    return left.get() > right.get();
-}
+    template<typename Ty1, typename D1, typename Ty2, typename D2>
+    bool operator>(const Ubpa::USTL::unique_object<Ty1, D1>& left, const Ubpa::USTL::unique_object<Ty2, D2>& right) noexcept {
+        return left.get() > right.get();
+    }
 
-template<typename Ty1, typename D1, typename Ty2, typename D2>
-bool operator<=(const Ubpa::USTL::unique_object<Ty1, D1>& left, const Ubpa::USTL::unique_object<Ty2, D2>& right) noexcept {
-    return left.get() <= right.get();
-}
+    template<typename Ty1, typename D1, typename Ty2, typename D2>
+    bool operator<=(const Ubpa::USTL::unique_object<Ty1, D1>& left, const Ubpa::USTL::unique_object<Ty2, D2>& right) noexcept {
+        return left.get() <= right.get();
+    }
 
-template<typename Ty1, typename D1, typename Ty2, typename D2>
-bool operator==(const std::unique_ptr<Ty1, D1>& left, const Ubpa::USTL::unique_object<Ty2, D2>& right) noexcept {
-    return left.get() == right.get();
-}
+    template<typename Ty1, typename D1, typename Ty2, typename D2>
+    bool operator==(const std::unique_ptr<Ty1, D1>& left, const Ubpa::USTL::unique_object<Ty2, D2>& right) noexcept {
+        return left.get() == right.get();
+    }
 
-template<typename Ty1, typename D1, typename Ty2, typename D2>
-bool operator!=(const std::unique_ptr<Ty1, D1>& left, const Ubpa::USTL::unique_object<Ty2, D2>& right) noexcept {
-    return left.get() != right.get();
-}
+    template<typename Ty1, typename D1, typename Ty2, typename D2>
+    bool operator!=(const std::unique_ptr<Ty1, D1>& left, const Ubpa::USTL::unique_object<Ty2, D2>& right) noexcept {
+        return left.get() != right.get();
+    }
 
-template<typename Ty1, typename D1, typename Ty2, typename D2>
-bool operator<(const std::unique_ptr<Ty1, D1>& left, const Ubpa::USTL::unique_object<Ty2, D2>& right) noexcept {
-    return left.get() < right.get();
-}
+    template<typename Ty1, typename D1, typename Ty2, typename D2>
+    bool operator<(const std::unique_ptr<Ty1, D1>& left, const Ubpa::USTL::unique_object<Ty2, D2>& right) noexcept {
+        return left.get() < right.get();
+    }
 
-template<typename Ty1, typename D1, typename Ty2, typename D2>
-bool operator>=(const std::unique_ptr<Ty1, D1>& left, const Ubpa::USTL::unique_object<Ty2, D2>& right) noexcept {
-    return left.get() >= right.get();
-}
+    template<typename Ty1, typename D1, typename Ty2, typename D2>
+    bool operator>=(const std::unique_ptr<Ty1, D1>& left, const Ubpa::USTL::unique_object<Ty2, D2>& right) noexcept {
+        return left.get() >= right.get();
+    }
 
-template<typename Ty1, typename D1, typename Ty2, typename D2>
-bool operator>(const std::unique_ptr<Ty1, D1>& left, const Ubpa::USTL::unique_object<Ty2, D2>& right) noexcept {
-    return left.get() > right.get();
-}
+    template<typename Ty1, typename D1, typename Ty2, typename D2>
+    bool operator>(const std::unique_ptr<Ty1, D1>& left, const Ubpa::USTL::unique_object<Ty2, D2>& right) noexcept {
+        return left.get() > right.get();
+    }
 
-template<typename Ty1, typename D1, typename Ty2, typename D2>
-bool operator<=(const std::unique_ptr<Ty1, D1>& left, const Ubpa::USTL::unique_object<Ty2, D2>& right) noexcept {
-    return left.get() <= right.get();
-}
+    template<typename Ty1, typename D1, typename Ty2, typename D2>
+    bool operator<=(const std::unique_ptr<Ty1, D1>& left, const Ubpa::USTL::unique_object<Ty2, D2>& right) noexcept {
+        return left.get() <= right.get();
+    }
 
-template<typename Ty1, typename D1, typename Ty2, typename D2>
-bool operator==(const Ubpa::USTL::unique_object<Ty1, D1>& left, const std::unique_ptr<Ty2, D2>& right) noexcept {
-    return left.get() == right.get();
-}
+    template<typename Ty1, typename D1, typename Ty2, typename D2>
+    bool operator==(const Ubpa::USTL::unique_object<Ty1, D1>& left, const std::unique_ptr<Ty2, D2>& right) noexcept {
+        return left.get() == right.get();
+    }
 
-template<typename Ty1, typename D1, typename Ty2, typename D2>
-bool operator!=(const Ubpa::USTL::unique_object<Ty1, D1>& left, const std::unique_ptr<Ty2, D2>& right) noexcept {
-    return left.get() != right.get();
-}
+    template<typename Ty1, typename D1, typename Ty2, typename D2>
+    bool operator!=(const Ubpa::USTL::unique_object<Ty1, D1>& left, const std::unique_ptr<Ty2, D2>& right) noexcept {
+        return left.get() != right.get();
+    }
 
-template<typename Ty1, typename D1, typename Ty2, typename D2>
-bool operator<(const Ubpa::USTL::unique_object<Ty1, D1>& left, const std::unique_ptr<Ty2, D2>& right) noexcept {
-    return left.get() < right.get();
-}
+    template<typename Ty1, typename D1, typename Ty2, typename D2>
+    bool operator<(const Ubpa::USTL::unique_object<Ty1, D1>& left, const std::unique_ptr<Ty2, D2>& right) noexcept {
+        return left.get() < right.get();
+    }
 
-template<typename Ty1, typename D1, typename Ty2, typename D2>
-bool operator>=(const Ubpa::USTL::unique_object<Ty1, D1>& left, const std::unique_ptr<Ty2, D2>& right) noexcept {
-    return left.get() >= right.get();
-}
+    template<typename Ty1, typename D1, typename Ty2, typename D2>
+    bool operator>=(const Ubpa::USTL::unique_object<Ty1, D1>& left, const std::unique_ptr<Ty2, D2>& right) noexcept {
+        return left.get() >= right.get();
+    }
 
-template<typename Ty1, typename D1, typename Ty2, typename D2>
-bool operator>(const Ubpa::USTL::unique_object<Ty1, D1>& left, const std::unique_ptr<Ty2, D2>& right) noexcept {
-    return left.get() > right.get();
-}
+    template<typename Ty1, typename D1, typename Ty2, typename D2>
+    bool operator>(const Ubpa::USTL::unique_object<Ty1, D1>& left, const std::unique_ptr<Ty2, D2>& right) noexcept {
+        return left.get() > right.get();
+    }
 
-template<typename Ty1, typename D1, typename Ty2, typename D2>
-bool operator<=(const Ubpa::USTL::unique_object<Ty1, D1>& left, const std::unique_ptr<Ty2, D2>& right) noexcept {
-    return left.get() <= right.get();
-}
+    template<typename Ty1, typename D1, typename Ty2, typename D2>
+    bool operator<=(const Ubpa::USTL::unique_object<Ty1, D1>& left, const std::unique_ptr<Ty2, D2>& right) noexcept {
+        return left.get() <= right.get();
+    }
 
-template <typename T, typename D>
-bool operator==(const Ubpa::USTL::unique_object<T, D>& left, std::nullptr_t) noexcept {
-    return left.get() == nullptr;
-}
+    template <typename T, typename D>
+    bool operator==(const Ubpa::USTL::unique_object<T, D>& left, std::nullptr_t) noexcept {
+        return left.get() == nullptr;
+    }
 
-template <typename T, typename D>
-bool operator==(std::nullptr_t, const Ubpa::USTL::unique_object<T, D>& right) noexcept {
-    return nullptr == right.get();
-}
+    template <typename T, typename D>
+    bool operator==(std::nullptr_t, const Ubpa::USTL::unique_object<T, D>& right) noexcept {
+        return nullptr == right.get();
+    }
 
-template <typename T, typename D>
-bool operator!=(const Ubpa::USTL::unique_object<T, D>& left, std::nullptr_t) noexcept {
-    return left.get() != nullptr;
-}
+    template <typename T, typename D>
+    bool operator!=(const Ubpa::USTL::unique_object<T, D>& left, std::nullptr_t) noexcept {
+        return left.get() != nullptr;
+    }
 
-template <typename T, typename D>
-bool operator!=(std::nullptr_t, const Ubpa::USTL::unique_object<T, D>& right) noexcept {
-    return nullptr != right.get();
-}
+    template <typename T, typename D>
+    bool operator!=(std::nullptr_t, const Ubpa::USTL::unique_object<T, D>& right) noexcept {
+        return nullptr != right.get();
+    }
 
-template <typename T, typename D>
-bool operator<(const Ubpa::USTL::unique_object<T, D>& left, std::nullptr_t) noexcept {
-    return left.get() < static_cast<typename Ubpa::USTL::unique_object<T, D>::pointer>(nullptr);
-}
+    template <typename T, typename D>
+    bool operator<(const Ubpa::USTL::unique_object<T, D>& left, std::nullptr_t) noexcept {
+        return left.get() < static_cast<typename Ubpa::USTL::unique_object<T, D>::pointer>(nullptr);
+    }
 
-template <typename T, typename D>
-bool operator<(std::nullptr_t, const Ubpa::USTL::shared_object<T>& right) noexcept {
-    return static_cast<typename Ubpa::USTL::unique_object<T, D>::pointer>(nullptr) < right.get();
-}
+    template <typename T, typename D>
+    bool operator<(std::nullptr_t, const Ubpa::USTL::shared_object<T>& right) noexcept {
+        return static_cast<typename Ubpa::USTL::unique_object<T, D>::pointer>(nullptr) < right.get();
+    }
 
-template <typename T, typename D>
-bool operator>=(const Ubpa::USTL::shared_object<T>& left, std::nullptr_t) noexcept {
-    return left.get() >= static_cast<typename Ubpa::USTL::unique_object<T, D>::pointer>(nullptr);
-}
+    template <typename T, typename D>
+    bool operator>=(const Ubpa::USTL::shared_object<T>& left, std::nullptr_t) noexcept {
+        return left.get() >= static_cast<typename Ubpa::USTL::unique_object<T, D>::pointer>(nullptr);
+    }
 
-template <typename T, typename D>
-bool operator>=(std::nullptr_t, const Ubpa::USTL::shared_object<T>& right) noexcept {
-    return static_cast<typename Ubpa::USTL::unique_object<T, D>::pointer>(nullptr) >= right.get();
-}
+    template <typename T, typename D>
+    bool operator>=(std::nullptr_t, const Ubpa::USTL::shared_object<T>& right) noexcept {
+        return static_cast<typename Ubpa::USTL::unique_object<T, D>::pointer>(nullptr) >= right.get();
+    }
 
-template <typename T, typename D>
-bool operator>(const Ubpa::USTL::shared_object<T>& left, std::nullptr_t) noexcept {
-    return left.get() > static_cast<typename Ubpa::USTL::unique_object<T, D>::pointer>(nullptr);
-}
+    template <typename T, typename D>
+    bool operator>(const Ubpa::USTL::shared_object<T>& left, std::nullptr_t) noexcept {
+        return left.get() > static_cast<typename Ubpa::USTL::unique_object<T, D>::pointer>(nullptr);
+    }
 
-template <typename T, typename D>
-bool operator>(std::nullptr_t, const Ubpa::USTL::shared_object<T>& right) noexcept {
-    return static_cast<typename Ubpa::USTL::unique_object<T, D>::pointer>(nullptr) > right.get();
-}
+    template <typename T, typename D>
+    bool operator>(std::nullptr_t, const Ubpa::USTL::shared_object<T>& right) noexcept {
+        return static_cast<typename Ubpa::USTL::unique_object<T, D>::pointer>(nullptr) > right.get();
+    }
 
-template <typename T, typename D>
-bool operator<=(const Ubpa::USTL::shared_object<T>& left, std::nullptr_t) noexcept {
-    return left.get() <= static_cast<typename Ubpa::USTL::unique_object<T, D>::pointer>(nullptr);
-}
+    template <typename T, typename D>
+    bool operator<=(const Ubpa::USTL::shared_object<T>& left, std::nullptr_t) noexcept {
+        return left.get() <= static_cast<typename Ubpa::USTL::unique_object<T, D>::pointer>(nullptr);
+    }
 
-template <typename T, typename D>
-bool operator<=(std::nullptr_t, const Ubpa::USTL::shared_object<T>& right) noexcept {
-    return static_cast<typename Ubpa::USTL::unique_object<T, D>::pointer>(nullptr) <= right.get();
+    template <typename T, typename D>
+    bool operator<=(std::nullptr_t, const Ubpa::USTL::shared_object<T>& right) noexcept {
+        return static_cast<typename Ubpa::USTL::unique_object<T, D>::pointer>(nullptr) <= right.get();
+    }
 }
 
 // Output
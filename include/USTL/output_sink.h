@@ -0,0 +1,211 @@
+#pragma once
+
+#include "charconv.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+#include "details/output_sink.inl"
+
+namespace Ubpa::USTL {
+	// appends to a caller-provided buffer, never allocates
+	// characters past the end are dropped and reported by overflowed()
+	class fixed_buffer_writer {
+	public:
+		constexpr fixed_buffer_writer(char* first, char* last) noexcept
+			: first_{ first }, cur_{ first }, last_{ last } {}
+
+		template<std::size_t N>
+		constexpr fixed_buffer_writer(char(&buffer)[N]) noexcept
+			: fixed_buffer_writer{ buffer, buffer + N } {}
+
+		constexpr void write(std::string_view str) noexcept {
+			std::size_t n = str.size();
+			if (n > available()) {
+				n = available();
+				overflowed_ = true;
+			}
+			details::str_copy(cur_, str.data(), n);
+			cur_ += n;
+		}
+
+		constexpr void put(char c) noexcept {
+			if (cur_ == last_) {
+				overflowed_ = true;
+				return;
+			}
+			*cur_++ = c;
+		}
+
+		template<std::size_t Base = 10, typename T>
+		constexpr void write_integer(T value) noexcept {
+			static_assert(std::is_integral_v<T>);
+			if (available() >= integer_max_length<T, Base>)
+				cur_ = details::write_integer<Base>(cur_, value);
+			else {
+				char buffer[integer_max_length<T, Base>]{};
+				const char* last = details::write_integer<Base>(buffer, value);
+				write({ buffer, static_cast<std::size_t>(last - buffer) });
+			}
+		}
+
+		constexpr std::string_view view() const noexcept { return { first_, size() }; }
+		constexpr std::size_t size() const noexcept { return static_cast<std::size_t>(cur_ - first_); }
+		constexpr std::size_t capacity() const noexcept { return static_cast<std::size_t>(last_ - first_); }
+		constexpr std::size_t available() const noexcept { return static_cast<std::size_t>(last_ - cur_); }
+		constexpr bool overflowed() const noexcept { return overflowed_; }
+
+		constexpr void clear() noexcept {
+			cur_ = first_;
+			overflowed_ = false;
+		}
+
+	private:
+		char* first_;
+		char* cur_;
+		char* last_;
+		bool overflowed_{ false };
+	};
+
+	// flush target of output_sink, returns false on error
+	using output_sink_flush = bool(*)(void* context, const char* data, std::size_t size);
+
+	// buffers Capacity characters inline and hands them to the target in one call
+	// the destructor flushes what is left
+	template<std::size_t Capacity = 4096>
+	class output_sink {
+		static_assert(Capacity >= 64, "output_sink needs room for any integer.");
+	public:
+		output_sink(output_sink_flush flush, void* context) noexcept
+			: flush_{ flush }, context_{ context } {}
+
+		// f(std::string_view) is called on every flush, f must outlive the sink
+		template<typename F, std::enable_if_t<std::is_invocable_v<F&, std::string_view>, int> = 0>
+		explicit output_sink(F& f) noexcept
+			: output_sink{ &details::flush_to_callback<F>, &f } {}
+
+		// ::write / _write, partial writes are retried
+		static output_sink to_fd(int fd) noexcept {
+			return { &details::flush_to_fd, reinterpret_cast<void*>(static_cast<std::intptr_t>(fd)) };
+		}
+
+		// fwrite, the FILE is not flushed
+		static output_sink to_file(std::FILE* file) noexcept {
+			return { &details::flush_to_file, file };
+		}
+
+		output_sink(const output_sink&) = delete;
+		output_sink& operator=(const output_sink&) = delete;
+
+		~output_sink() { flush(); }
+
+		void write(std::string_view str) {
+			// size_ <= Capacity is an invariant, spelled out so the copy is visibly in bounds
+			if (size_ <= Capacity && str.size() <= Capacity - size_) {
+				std::memcpy(buffer_.data() + size_, str.data(), str.size());
+				size_ += str.size();
+				return;
+			}
+			flush();
+			if (str.size() < Capacity) {
+				std::memcpy(buffer_.data(), str.data(), str.size());
+				size_ = str.size();
+			}
+			else
+				emit(str.data(), str.size());
+		}
+
+		void put(char c) {
+			if (size_ == Capacity)
+				flush();
+			buffer_[size_++] = c;
+		}
+
+		template<std::size_t Base = 10, typename T>
+		void write_integer(T value) {
+			static_assert(std::is_integral_v<T>);
+			if (Capacity - size_ < integer_max_length<T, Base>)
+				flush();
+			size_ = static_cast<std::size_t>(details::write_integer<Base>(buffer_.data() + size_, value) - buffer_.data());
+		}
+
+		void flush() {
+			if (size_ == 0)
+				return;
+			emit(buffer_.data(), size_);
+			size_ = 0;
+		}
+
+		// buffered, not yet flushed
+		std::size_t size() const noexcept { return size_; }
+		static constexpr std::size_t capacity() noexcept { return Capacity; }
+
+		// false once a flush failed
+		bool good() const noexcept { return good_; }
+
+	private:
+		void emit(const char* data, std::size_t size) {
+			if (!flush_(context_, data, size))
+				good_ = false;
+		}
+
+		output_sink_flush flush_;
+		void* context_;
+		std::size_t size_{ 0 };
+		bool good_{ true };
+		std::array<char, Capacity> buffer_;
+	};
+
+	namespace details {
+		template<> struct is_output_sink<fixed_buffer_writer> : std::true_type {};
+		template<std::size_t Capacity> struct is_output_sink<output_sink<Capacity>> : std::true_type {};
+	}
+
+	// strings (cstring, inplace_string, std::string, literals, ...) are appended in one copy
+	template<typename Sink, std::enable_if_t<details::is_output_sink_v<Sink>, int> = 0>
+	constexpr Sink& operator<<(Sink& sink, std::string_view str) {
+		sink.write(str);
+		return sink;
+	}
+
+	template<typename Sink, std::enable_if_t<details::is_output_sink_v<Sink>, int> = 0>
+	constexpr Sink& operator<<(Sink& sink, const char* str) {
+		sink.write(str);
+		return sink;
+	}
+
+	template<typename Sink, std::enable_if_t<details::is_output_sink_v<Sink>, int> = 0>
+	constexpr Sink& operator<<(Sink& sink, char c) {
+		sink.put(c);
+		return sink;
+	}
+
+	template<typename Sink, typename T,
+		std::enable_if_t<details::is_output_sink_v<Sink> && details::is_sink_signed_unsigned_char_v<T>, int> = 0>
+	constexpr Sink& operator<<(Sink& sink, T c) {
+		sink.put(static_cast<char>(c));
+		return sink;
+	}
+
+	// not encoded, write UTF-8 (or cast to an integer for the code) explicitly
+	template<typename Sink, typename T,
+		std::enable_if_t<details::is_output_sink_v<Sink> && details::is_sink_wide_char_v<T>, int> = 0>
+	Sink& operator<<(Sink& sink, T) = delete;
+
+	// decimal, see write_integer
+	template<typename Sink, typename T,
+		std::enable_if_t<details::is_output_sink_v<Sink> && details::is_sink_integer_v<T>, int> = 0>
+	constexpr Sink& operator<<(Sink& sink, T value) {
+		sink.write_integer(value);
+		return sink;
+	}
+
+	// not formatted, write "true" / "false" explicitly
+	template<typename Sink, std::enable_if_t<details::is_output_sink_v<Sink>, int> = 0>
+	Sink& operator<<(Sink& sink, bool) = delete;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "cstring.h"
+
+#include <cstddef>
+#include <string_view>
+
+#include "details/pattern.inl"
+
+namespace Ubpa::USTL {
+	enum class pattern_syntax {
+		glob, // * ? [abc] [a-z] [!a] \x
+		regex // . [abc] [^a] \d \w \s \x, each followed by an optional * + ?; no groups, alternation or anchors
+	};
+
+	// matches a whole string against a pattern known at compile time
+	// the pattern (a constexpr cstring, string_view, ...) is compiled into a DFA table at compile time,
+	// matching is one table lookup per character and never allocates
+	template<const auto& Pattern, pattern_syntax Syntax = pattern_syntax::glob>
+	class static_pattern {
+		using impl = details::static_pattern_<Pattern, Syntax == pattern_syntax::glob>;
+
+	public:
+		static constexpr std::size_t state_count = impl::state_count;
+
+		static constexpr bool match(std::string_view str) noexcept {
+			std::size_t state = 1;
+			for (const auto c : str) {
+				state = impl::transitions[state * impl::class_count + impl::classes.of[static_cast<unsigned char>(c)]];
+				if (state == 0)
+					return false;
+			}
+			return impl::accepts[state];
+		}
+
+		constexpr bool operator()(std::string_view str) const noexcept { return match(str); }
+	};
+
+	template<const auto& Pattern>
+	using static_glob = static_pattern<Pattern, pattern_syntax::glob>;
+
+	template<const auto& Pattern>
+	using static_regex = static_pattern<Pattern, pattern_syntax::regex>;
+}
@@ -0,0 +1,523 @@
+#pragma once
+
+#include "compress_pair.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "details/small_vector.inl"
+
+namespace Ubpa::USTL {
+	// std::vector with room for N elements inside the object, the allocator is used beyond that
+	// - a stateless allocator takes no space (compress_pair)
+	// - trivially copyable elements are relocated with memcpy / memmove
+	// - moving from an inline small_vector moves its elements one by one
+	// iterators are pointers; the guarantees are those of std::vector
+	template<typename T, std::size_t N, typename Alloc = std::allocator<T>>
+	class small_vector {
+		static_assert(N > 0, "small_vector needs inline room, use std::vector for N == 0.");
+		static_assert(std::is_same_v<T, typename std::allocator_traits<Alloc>::value_type>);
+		using traits = std::allocator_traits<Alloc>;
+		static constexpr bool trivially_relocatable = details::is_trivially_relocatable_v<T, Alloc>;
+	public:
+		using value_type = T;
+		using allocator_type = Alloc;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using reference = T&;
+		using const_reference = const T&;
+		using pointer = T*;
+		using const_pointer = const T*;
+		using iterator = T*;
+		using const_iterator = const T*;
+		using reverse_iterator = std::reverse_iterator<iterator>;
+		using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+		static constexpr size_type inline_capacity = N;
+
+		small_vector() noexcept(std::is_nothrow_default_constructible_v<Alloc>)
+			: alloc_data_{ zero_then_variadic_args_t{}, inline_data() } {}
+
+		explicit small_vector(const Alloc& alloc) noexcept
+			: alloc_data_{ one_then_variadic_args_t{}, alloc, inline_data() } {}
+
+		// delegating, so the destructor cleans up if an element constructor throws
+		explicit small_vector(size_type count, const Alloc& alloc = Alloc{}) : small_vector{ alloc } {
+			resize(count);
+		}
+
+		small_vector(size_type count, const T& value, const Alloc& alloc = Alloc{}) : small_vector{ alloc } {
+			assign(count, value);
+		}
+
+		template<typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+		small_vector(InputIt first, InputIt last, const Alloc& alloc = Alloc{}) : small_vector{ alloc } {
+			assign(first, last);
+		}
+
+		small_vector(std::initializer_list<T> ilist, const Alloc& alloc = Alloc{}) : small_vector{ alloc } {
+			assign(ilist.begin(), ilist.end());
+		}
+
+		small_vector(const small_vector& other)
+			: small_vector{ traits::select_on_container_copy_construction(other.get_allocator()) }
+		{
+			assign(other.begin(), other.end());
+		}
+
+		small_vector(small_vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+			: small_vector{ other.alloc() }
+		{
+			steal_or_move(other);
+		}
+
+		small_vector& operator=(const small_vector& rhs) {
+			if (this == &rhs)
+				return *this;
+			if constexpr (traits::propagate_on_container_copy_assignment::value) {
+				if (alloc() != rhs.alloc()) {
+					clear();
+					release();
+				}
+				alloc() = rhs.alloc();
+			}
+			assign(rhs.begin(), rhs.end());
+			return *this;
+		}
+
+		small_vector& operator=(small_vector&& rhs) noexcept(std::is_nothrow_move_constructible_v<T>
+			&& (traits::propagate_on_container_move_assignment::value || traits::is_always_equal::value))
+		{
+			if (this == &rhs)
+				return *this;
+			clear();
+			if constexpr (traits::propagate_on_container_move_assignment::value) {
+				release();
+				alloc() = std::move(rhs.alloc());
+			}
+			steal_or_move(rhs);
+			return *this;
+		}
+
+		small_vector& operator=(std::initializer_list<T> ilist) {
+			assign(ilist.begin(), ilist.end());
+			return *this;
+		}
+
+		~small_vector() {
+			clear();
+			release();
+		}
+
+		void assign(size_type count, const T& value) {
+			if (count > capacity_) {
+				const T copy(value); // value may be an element
+				clear();
+				reserve(count);
+				append_n(count, copy);
+			}
+			else {
+				std::fill_n(begin(), std::min(count, size_), value);
+				if (count > size_)
+					append_n(count - size_, value);
+				else
+					erase_to_end(begin() + count);
+			}
+		}
+
+		template<typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+		void assign(InputIt first, InputIt last) {
+			clear();
+			if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>)
+				reserve(static_cast<size_type>(std::distance(first, last)));
+			for (; first != last; ++first)
+				emplace_back(*first);
+		}
+
+		void assign(std::initializer_list<T> ilist) { assign(ilist.begin(), ilist.end()); }
+
+		allocator_type get_allocator() const noexcept { return alloc(); }
+
+		// [element access]
+
+		reference at(size_type i) {
+			if (i >= size_)
+				throw std::out_of_range{ "small_vector::at" };
+			return data()[i];
+		}
+
+		const_reference at(size_type i) const {
+			if (i >= size_)
+				throw std::out_of_range{ "small_vector::at" };
+			return data()[i];
+		}
+
+		reference operator[](size_type i) noexcept {
+			assert(i < size_);
+			return data()[i];
+		}
+
+		const_reference operator[](size_type i) const noexcept {
+			assert(i < size_);
+			return data()[i];
+		}
+
+		reference front() noexcept { return (*this)[0]; }
+		const_reference front() const noexcept { return (*this)[0]; }
+		reference back() noexcept { return (*this)[size_ - 1]; }
+		const_reference back() const noexcept { return (*this)[size_ - 1]; }
+
+		T* data() noexcept { return alloc_data_.get_second(); }
+		const T* data() const noexcept { return alloc_data_.get_second(); }
+
+		// [iterators]
+
+		iterator begin() noexcept { return data(); }
+		const_iterator begin() const noexcept { return data(); }
+		const_iterator cbegin() const noexcept { return data(); }
+		iterator end() noexcept { return data() + size_; }
+		const_iterator end() const noexcept { return data() + size_; }
+		const_iterator cend() const noexcept { return data() + size_; }
+
+		reverse_iterator rbegin() noexcept { return reverse_iterator{ end() }; }
+		const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator{ end() }; }
+		const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+		reverse_iterator rend() noexcept { return reverse_iterator{ begin() }; }
+		const_reverse_iterator rend() const noexcept { return const_reverse_iterator{ begin() }; }
+		const_reverse_iterator crend() const noexcept { return rend(); }
+
+		// [capacity]
+
+		bool empty() const noexcept { return size_ == 0; }
+		size_type size() const noexcept { return size_; }
+		size_type max_size() const noexcept { return traits::max_size(alloc()); }
+		size_type capacity() const noexcept { return capacity_; }
+
+		// the elements are in the inline buffer
+		bool is_inline() const noexcept { return data() == inline_data(); }
+
+		void reserve(size_type capacity) {
+			if (capacity > capacity_)
+				reallocate(capacity);
+		}
+
+		// back to the inline buffer if the elements fit
+		void shrink_to_fit() {
+			if (is_inline() || size_ == capacity_)
+				return;
+			if (size_ <= N) {
+				T* heap = data();
+				const size_type heap_capacity = capacity_;
+				details::small_vector_relocate(alloc(), heap, size_, inline_data());
+				traits::deallocate(alloc(), heap, heap_capacity);
+				set_buffer(inline_data(), N);
+			}
+			else
+				reallocate(size_);
+		}
+
+		// [modifiers]
+
+		void clear() noexcept {
+			details::small_vector_destroy(alloc(), begin(), end());
+			size_ = 0;
+		}
+
+		iterator insert(const_iterator pos, const T& value) { return emplace(pos, value); }
+		iterator insert(const_iterator pos, T&& value) { return emplace(pos, std::move(value)); }
+
+		iterator insert(const_iterator pos, size_type count, const T& value) {
+			const size_type i = index_of(pos);
+			const T copy(value); // value may be an element
+			reserve(size_ + count);
+			const size_type old_size = size_;
+			append_n(count, copy);
+			std::rotate(begin() + i, begin() + old_size, end());
+			return begin() + i;
+		}
+
+		template<typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+		iterator insert(const_iterator pos, InputIt first, InputIt last) {
+			const size_type i = index_of(pos);
+			const size_type old_size = size_;
+			if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>)
+				reserve(size_ + static_cast<size_type>(std::distance(first, last)));
+			for (; first != last; ++first)
+				emplace_back(*first);
+			std::rotate(begin() + i, begin() + old_size, end());
+			return begin() + i;
+		}
+
+		iterator insert(const_iterator pos, std::initializer_list<T> ilist) {
+			return insert(pos, ilist.begin(), ilist.end());
+		}
+
+		template<typename... Args>
+		iterator emplace(const_iterator pos, Args&&... args) {
+			const size_type i = index_of(pos);
+			if (i == size_) {
+				emplace_back(std::forward<Args>(args)...);
+				return begin() + i;
+			}
+			T value(std::forward<Args>(args)...); // args may refer to elements that are about to move
+			if (size_ == capacity_)
+				reallocate(next_capacity(size_ + 1));
+			T* p = data();
+			if constexpr (trivially_relocatable) {
+				std::memmove(static_cast<void*>(p + i + 1), static_cast<const void*>(p + i), (size_ - i) * sizeof(T));
+				traits::construct(alloc(), p + i, std::move(value));
+			}
+			else {
+				traits::construct(alloc(), p + size_, std::move(p[size_ - 1]));
+				std::move_backward(p + i, p + size_ - 1, p + size_);
+				p[i] = std::move(value);
+			}
+			size_++;
+			return p + i;
+		}
+
+		iterator erase(const_iterator pos) {
+			assert(pos != end());
+			return erase(pos, pos + 1);
+		}
+
+		iterator erase(const_iterator first, const_iterator last) {
+			T* p = begin() + index_of(first);
+			if (first != last)
+				erase_to_end(std::move(p + (last - first), end(), p));
+			return p;
+		}
+
+		template<typename... Args>
+		reference emplace_back(Args&&... args) {
+			if (size_ == capacity_)
+				return grow_emplace_back(std::forward<Args>(args)...);
+			T* p = data() + size_;
+			traits::construct(alloc(), p, std::forward<Args>(args)...);
+			size_++;
+			return *p;
+		}
+
+		void push_back(const T& value) { emplace_back(value); }
+		void push_back(T&& value) { emplace_back(std::move(value)); }
+
+		void pop_back() noexcept {
+			assert(size_ > 0);
+			size_--;
+			details::small_vector_destroy(alloc(), end(), end() + 1);
+		}
+
+		void resize(size_type count) {
+			if (count <= size_) {
+				erase_to_end(begin() + count);
+				return;
+			}
+			reserve(count);
+			while (size_ < count)
+				emplace_back();
+		}
+
+		void resize(size_type count, const T& value) {
+			if (count <= size_)
+				erase_to_end(begin() + count);
+			else if (count > capacity_) {
+				const T copy(value); // value may be an element
+				reserve(count);
+				append_n(count - size_, copy);
+			}
+			else
+				append_n(count - size_, value);
+		}
+
+		// two heap buffers swap pointers, otherwise the elements are moved
+		void swap(small_vector& other) noexcept(std::is_nothrow_move_constructible_v<T>
+			&& (traits::propagate_on_container_swap::value || traits::is_always_equal::value))
+		{
+			if (this == &other)
+				return;
+			if constexpr (!traits::propagate_on_container_swap::value)
+				assert(alloc() == other.alloc());
+			if (!is_inline() && !other.is_inline()) {
+				T* heap = data();
+				const size_type heap_capacity = capacity_;
+				set_buffer(other.data(), other.capacity_);
+				other.set_buffer(heap, heap_capacity);
+				std::swap(size_, other.size_);
+				swap_alloc(other);
+				return;
+			}
+			small_vector& small = is_inline() ? *this : other;
+			small_vector& large = is_inline() ? other : *this;
+			// small is inline, so its elements fit the other inline buffer;
+			// the allocators are swapped once only tmp holds a heap buffer, so it moves with its allocator
+			small_vector tmp{ large.alloc() };
+			tmp.steal_or_move(large);
+			large.steal_or_move(small);
+			swap_alloc(other);
+			small.steal_or_move(tmp);
+		}
+
+	private:
+		Alloc& alloc() noexcept { return alloc_data_.get_first(); }
+		const Alloc& alloc() const noexcept { return alloc_data_.get_first(); }
+
+		T* inline_data() noexcept { return reinterpret_cast<T*>(inline_); }
+		const T* inline_data() const noexcept { return reinterpret_cast<const T*>(inline_); }
+
+		size_type index_of(const_iterator pos) const noexcept {
+			assert(begin() <= pos && pos <= end());
+			return static_cast<size_type>(pos - begin());
+		}
+
+		size_type next_capacity(size_type required) const noexcept {
+			return std::max(2 * capacity_, required);
+		}
+
+		void swap_alloc(small_vector& other) noexcept {
+			if constexpr (traits::propagate_on_container_swap::value) {
+				using std::swap;
+				swap(alloc(), other.alloc());
+			}
+		}
+
+		void set_buffer(T* buffer, size_type capacity) noexcept {
+			alloc_data_.get_second() = buffer;
+			capacity_ = capacity;
+		}
+
+		// the heap buffer if any, back to the inline one; the elements must be destroyed
+		void release() noexcept {
+			if (!is_inline())
+				traits::deallocate(alloc(), data(), capacity_);
+			set_buffer(inline_data(), N);
+		}
+
+		void erase_to_end(T* first) noexcept {
+			details::small_vector_destroy(alloc(), first, end());
+			size_ = static_cast<size_type>(first - data());
+		}
+
+		// capacity_ >= size_ + count
+		void append_n(size_type count, const T& value) {
+			for (; count > 0; count--) {
+				traits::construct(alloc(), data() + size_, value);
+				size_++;
+			}
+		}
+
+		void reallocate(size_type capacity) {
+			T* buffer = traits::allocate(alloc(), capacity);
+			try {
+				details::small_vector_relocate(alloc(), data(), size_, buffer);
+			}
+			catch (...) {
+				traits::deallocate(alloc(), buffer, capacity);
+				throw;
+			}
+			replace_buffer(buffer, capacity);
+		}
+
+		// the elements were relocated to buffer
+		void replace_buffer(T* buffer, size_type capacity) noexcept {
+			if (!is_inline())
+				traits::deallocate(alloc(), data(), capacity_);
+			set_buffer(buffer, capacity);
+		}
+
+		// the new element is built before relocating, so args may refer to elements
+		template<typename... Args>
+		reference grow_emplace_back(Args&&... args) {
+			const size_type capacity = next_capacity(size_ + 1);
+			T* buffer = traits::allocate(alloc(), capacity);
+			try {
+				traits::construct(alloc(), buffer + size_, std::forward<Args>(args)...);
+			}
+			catch (...) {
+				traits::deallocate(alloc(), buffer, capacity);
+				throw;
+			}
+			try {
+				details::small_vector_relocate(alloc(), data(), size_, buffer);
+			}
+			catch (...) {
+				traits::destroy(alloc(), buffer + size_);
+				traits::deallocate(alloc(), buffer, capacity);
+				throw;
+			}
+			replace_buffer(buffer, capacity);
+			return buffer[size_++];
+		}
+
+		// this is empty; takes other's heap buffer if the allocators allow it, moves the elements otherwise
+		void steal_or_move(small_vector& other) {
+			assert(size_ == 0);
+			if (!other.is_inline() && (traits::is_always_equal::value || alloc() == other.alloc())) {
+				release();
+				set_buffer(other.data(), other.capacity_);
+				size_ = other.size_;
+				other.set_buffer(other.inline_data(), N);
+				other.size_ = 0;
+				return;
+			}
+			reserve(other.size_);
+			if constexpr (trivially_relocatable) {
+				details::small_vector_relocate(alloc(), other.data(), other.size_, data());
+				size_ = other.size_;
+			}
+			else {
+				for (T& e : other)
+					emplace_back(std::move(e));
+				other.clear();
+			}
+			other.size_ = 0;
+		}
+
+		compress_pair<Alloc, T*> alloc_data_; // the allocator takes no space if it is empty
+		size_type size_{ 0 };
+		size_type capacity_{ N };
+		alignas(T) unsigned char inline_[sizeof(T) * N];
+	};
+
+	template<typename T, std::size_t N, typename Alloc>
+	bool operator==(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs) {
+		return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+	}
+
+	template<typename T, std::size_t N, typename Alloc>
+	bool operator!=(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs) {
+		return !(lhs == rhs);
+	}
+
+	template<typename T, std::size_t N, typename Alloc>
+	bool operator<(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs) {
+		return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	}
+
+	template<typename T, std::size_t N, typename Alloc>
+	bool operator>(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs) {
+		return rhs < lhs;
+	}
+
+	template<typename T, std::size_t N, typename Alloc>
+	bool operator<=(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs) {
+		return !(rhs < lhs);
+	}
+
+	template<typename T, std::size_t N, typename Alloc>
+	bool operator>=(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs) {
+		return !(lhs < rhs);
+	}
+
+	template<typename T, std::size_t N, typename Alloc>
+	void swap(small_vector<T, N, Alloc>& lhs, small_vector<T, N, Alloc>& rhs) noexcept(noexcept(lhs.swap(rhs))) {
+		lhs.swap(rhs);
+	}
+}
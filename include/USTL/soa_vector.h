@@ -0,0 +1,281 @@
+#pragma once
+
+#include "tuple.h"
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "details/soa_vector.inl"
+
+namespace Ubpa::USTL {
+	// contiguous view of one soa_vector column
+	template<typename T>
+	class soa_column {
+	public:
+		constexpr soa_column(T* data, std::size_t size) noexcept : data_{ data }, size_{ size } {}
+
+		constexpr T* data() const noexcept { return data_; }
+		constexpr std::size_t size() const noexcept { return size_; }
+		constexpr bool empty() const noexcept { return size_ == 0; }
+
+		constexpr T* begin() const noexcept { return data_; }
+		constexpr T* end() const noexcept { return data_ + size_; }
+
+		constexpr T& operator[](std::size_t i) const noexcept {
+			assert(i < size_);
+			return data_[i];
+		}
+
+	private:
+		T* data_;
+		std::size_t size_;
+	};
+
+	// structure of arrays: one column per element type, all in a single allocation
+	// - every column starts on a column_alignment boundary, and they grow together
+	// - rows are std::tuple<Ts&...> proxies, usable with tuple_for_each etc.
+	// - columns are soa_column spans, for vectorizable per-column loops
+	// relocation moves if nothrow, copies otherwise (as std::vector)
+	template<typename... Ts>
+	class soa_vector {
+		static_assert(sizeof...(Ts) > 0);
+		static_assert((std::is_same_v<Ts, std::remove_cv_t<Ts>> && ...) && (std::is_object_v<Ts> && ...),
+			"soa_vector columns must be non-const object types.");
+	public:
+		static constexpr std::size_t column_alignment = 64;
+
+		using value_type = std::tuple<Ts...>;
+		using reference = std::tuple<Ts&...>;
+		using const_reference = std::tuple<const Ts&...>;
+		using size_type = std::size_t;
+
+		template<std::size_t I>
+		using column_type = std::tuple_element_t<I, value_type>;
+
+		soa_vector() noexcept = default;
+
+		// delegating, so the destructor frees the block if a copy throws
+		soa_vector(const soa_vector& other) : soa_vector{} {
+			reserve(other.size_);
+			copy_columns(other, std::index_sequence_for<Ts...>{});
+			size_ = other.size_;
+		}
+
+		soa_vector(soa_vector&& other) noexcept
+			: block_{ std::exchange(other.block_, nullptr) },
+			columns_{ std::exchange(other.columns_, {}) },
+			size_{ std::exchange(other.size_, 0) },
+			capacity_{ std::exchange(other.capacity_, 0) } {}
+
+		soa_vector& operator=(const soa_vector& rhs) {
+			if (this != &rhs) {
+				soa_vector copy{ rhs };
+				swap(copy);
+			}
+			return *this;
+		}
+
+		soa_vector& operator=(soa_vector&& rhs) noexcept {
+			soa_vector moved{ std::move(rhs) };
+			swap(moved);
+			return *this;
+		}
+
+		~soa_vector() {
+			clear();
+			layout::deallocate(block_);
+		}
+
+		void swap(soa_vector& other) noexcept {
+			std::swap(block_, other.block_);
+			std::swap(columns_, other.columns_);
+			std::swap(size_, other.size_);
+			std::swap(capacity_, other.capacity_);
+		}
+
+		size_type size() const noexcept { return size_; }
+		size_type capacity() const noexcept { return capacity_; }
+		bool empty() const noexcept { return size_ == 0; }
+
+		void reserve(size_type capacity) {
+			if (capacity > capacity_)
+				reallocate(capacity);
+		}
+
+		void clear() noexcept {
+			destroy_rows(columns_, 0, size_);
+			size_ = 0;
+		}
+
+		// one argument per column
+		template<typename... Args>
+		reference emplace_back(Args&&... args) {
+			static_assert(sizeof...(Args) == sizeof...(Ts), "soa_vector::emplace_back takes one argument per column.");
+			if (size_ == capacity_) {
+				// the new row is built before relocating, so args may refer to elements
+				const size_type capacity = capacity_ == 0 ? 8 : 2 * capacity_;
+				std::tuple<Ts*...> columns;
+				void* block = layout::allocate(capacity, columns);
+				try {
+					construct_row(columns, size_, std::index_sequence_for<Ts...>{}, std::forward<Args>(args)...);
+				}
+				catch (...) {
+					layout::deallocate(block);
+					throw;
+				}
+				try {
+					relocate(columns, std::index_sequence_for<Ts...>{});
+				}
+				catch (...) {
+					destroy_rows(columns, size_, size_ + 1);
+					layout::deallocate(block);
+					throw;
+				}
+				replace_block(block, columns, capacity);
+			}
+			else
+				construct_row(columns_, size_, std::index_sequence_for<Ts...>{}, std::forward<Args>(args)...);
+			return (*this)[size_++];
+		}
+
+		reference push_back(const value_type& row) {
+			return std::apply([this](const Ts&... elems) -> reference { return emplace_back(elems...); }, row);
+		}
+
+		reference push_back(value_type&& row) {
+			return std::apply([this](Ts&... elems) -> reference { return emplace_back(std::move(elems)...); }, row);
+		}
+
+		void pop_back() noexcept {
+			assert(size_ > 0);
+			destroy_rows(columns_, size_ - 1, size_);
+			size_--;
+		}
+
+		reference operator[](size_type i) noexcept {
+			assert(i < size_);
+			return row(i, std::index_sequence_for<Ts...>{});
+		}
+
+		const_reference operator[](size_type i) const noexcept {
+			assert(i < size_);
+			return row(i, std::index_sequence_for<Ts...>{});
+		}
+
+		reference back() noexcept { return (*this)[size_ - 1]; }
+		const_reference back() const noexcept { return (*this)[size_ - 1]; }
+
+		template<std::size_t I>
+		soa_column<column_type<I>> column() noexcept { return { std::get<I>(columns_), size_ }; }
+		template<std::size_t I>
+		soa_column<const column_type<I>> column() const noexcept { return { std::get<I>(columns_), size_ }; }
+
+		// T must appear exactly once in Ts...
+		template<typename T>
+		soa_column<T> column() noexcept { return column<column_index<T>>(); }
+		template<typename T>
+		soa_column<const T> column() const noexcept { return column<column_index<T>>(); }
+
+	private:
+		using layout = details::soa_layout<column_alignment, Ts...>;
+
+		template<typename T>
+		static constexpr std::size_t column_index = [] {
+			static_assert(tuple_count_type<T, value_type> == 1, "soa_vector::column<T> needs T to be exactly one column.");
+			return tuple_index_of_type<T, value_type>;
+		}();
+
+		template<std::size_t... Is>
+		reference row(size_type i, std::index_sequence<Is...>) noexcept {
+			return { std::get<Is>(columns_)[i]... };
+		}
+
+		template<std::size_t... Is>
+		const_reference row(size_type i, std::index_sequence<Is...>) const noexcept {
+			return { std::get<Is>(columns_)[i]... };
+		}
+
+		// strong guarantee: constructed columns are destroyed if a later one throws
+		template<std::size_t... Is, typename... Args>
+		static void construct_row(const std::tuple<Ts*...>& columns, size_type i, std::index_sequence<Is...>, Args&&... args) {
+			std::size_t constructed = 0;
+			try {
+				((::new (static_cast<void*>(std::get<Is>(columns) + i)) Ts(std::forward<Args>(args)), constructed++), ...);
+			}
+			catch (...) {
+				((Is < constructed ? std::get<Is>(columns)[i].~Ts() : void()), ...);
+				throw;
+			}
+		}
+
+		static void destroy_rows(const std::tuple<Ts*...>& columns, size_type first, size_type last) noexcept {
+			std::apply([=](Ts*... cols) { (std::destroy(cols + first, cols + last), ...); }, columns);
+		}
+
+		// old elements into columns, the copying columns first (see soa_relocate_pass_v);
+		// if one throws, the relocated columns are destroyed and the old ones are untouched
+		// (unless a move-only column has a throwing move)
+		template<std::size_t... Is>
+		void relocate(const std::tuple<Ts*...>& columns, std::index_sequence<Is...> seq) {
+			bool relocated[sizeof...(Ts)] = {};
+			try {
+				relocate_pass<0>(columns, relocated, seq);
+				relocate_pass<1>(columns, relocated, seq);
+				relocate_pass<2>(columns, relocated, seq);
+			}
+			catch (...) {
+				((relocated[Is] ? std::destroy_n(std::get<Is>(columns), size_) : nullptr), ...);
+				throw;
+			}
+		}
+
+		template<int Pass, std::size_t... Is>
+		void relocate_pass(const std::tuple<Ts*...>& columns, bool(&relocated)[sizeof...(Ts)], std::index_sequence<Is...>) {
+			((details::soa_relocate_pass_v<Ts> == Pass
+				? (details::soa_relocate(std::get<Is>(columns_), size_, std::get<Is>(columns)), relocated[Is] = true)
+				: false), ...);
+		}
+
+		void reallocate(size_type capacity) {
+			std::tuple<Ts*...> columns;
+			void* block = layout::allocate(capacity, columns);
+			try {
+				relocate(columns, std::index_sequence_for<Ts...>{});
+			}
+			catch (...) {
+				layout::deallocate(block);
+				throw;
+			}
+			replace_block(block, columns, capacity);
+		}
+
+		void replace_block(void* block, const std::tuple<Ts*...>& columns, size_type capacity) noexcept {
+			destroy_rows(columns_, 0, size_);
+			layout::deallocate(block_);
+			block_ = block;
+			columns_ = columns;
+			capacity_ = capacity;
+		}
+
+		template<std::size_t... Is>
+		void copy_columns(const soa_vector& other, std::index_sequence<Is...>) {
+			std::size_t copied = 0;
+			try {
+				((std::uninitialized_copy_n(std::get<Is>(other.columns_), other.size_, std::get<Is>(columns_)), copied++), ...);
+			}
+			catch (...) {
+				((Is < copied ? std::destroy_n(std::get<Is>(columns_), other.size_) : nullptr), ...);
+				throw;
+			}
+		}
+
+		void* block_{ nullptr };
+		std::tuple<Ts*...> columns_{};
+		size_type size_{ 0 };
+		size_type capacity_{ 0 };
+	};
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "tuple.h"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "details/static_for.inl"
+
+namespace Ubpa::USTL {
+	// f(std::integral_constant<size_t, I>{}) for I in [0, N), unrolled
+	// the index is a constant expression: std::get<I>, template arguments, if constexpr
+	template<std::size_t N, typename Func>
+	constexpr void static_for(Func&& f) {
+		details::static_for(f, std::make_index_sequence<N>{});
+	}
+
+	// static_for<sizeof...(Masks)>, only the indices whose mask is true
+	template<bool... Masks, typename Func>
+	constexpr void static_for_masked(Func&& f) {
+		details::static_for<Masks...>(f, std::make_index_sequence<sizeof...(Masks)>{});
+	}
+
+	// std::array or built-in array, unrolled; Masks... as tuple_for_each (padded with true)
+	template<bool... Masks, typename Array, typename Func>
+	constexpr void array_for_each(Array&& a, Func&& f) {
+		constexpr std::size_t N = details::array_size_v<Array>;
+		static_assert(sizeof...(Masks) <= N);
+		details::array_for_each<Masks...>(a, f, std::make_index_sequence<N>{});
+	}
+
+	// acc = f(acc, a[I]) for every masked I in order, unrolled
+	// unlike tuple_accumulate the accumulator keeps the type of init, so the chain stays in registers
+	template<bool... Masks, typename Array, typename Init, typename Func>
+	constexpr std::decay_t<Init> array_accumulate(Array&& a, Init&& init, Func&& f) {
+		constexpr std::size_t N = details::array_size_v<Array>;
+		static_assert(sizeof...(Masks) <= N);
+		return details::array_accumulate<Masks...>(std::decay_t<Init>(std::forward<Init>(init)), a, f,
+			std::make_index_sequence<N>{});
+	}
+}
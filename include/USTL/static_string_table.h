@@ -0,0 +1,72 @@
+#pragma once
+
+#include "cstring.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+#include "details/static_string_table.inl"
+
+namespace Ubpa::USTL {
+	// (offset, length) into the blob of Table, 8 bytes
+	// equal strings of the same table have equal refs
+	template<typename Table>
+	struct static_string_ref {
+		std::uint32_t offset;
+		std::uint32_t length;
+
+		constexpr std::string_view view() const noexcept { return { Table::data() + offset, length }; }
+		constexpr operator std::string_view() const noexcept { return view(); }
+
+		friend constexpr bool operator==(static_string_ref lhs, static_string_ref rhs) noexcept {
+			return lhs.offset == rhs.offset && lhs.length == rhs.length;
+		}
+		friend constexpr bool operator!=(static_string_ref lhs, static_string_ref rhs) noexcept {
+			return !(lhs == rhs);
+		}
+	};
+
+	// interns the constexpr strings Strs (cstring, string_view, ...) into one contiguous constant blob
+	// duplicates and strings contained in longer ones share their characters
+	// static_string_table<type_name<A>, type_name<B>, enum_name<E::x>>
+	template<const auto&... Strs>
+	class static_string_table {
+		using storage = details::static_string_table_storage<Strs...>;
+	public:
+		using ref_type = static_string_ref<static_string_table>;
+
+		static constexpr std::size_t size() noexcept { return sizeof...(Strs); }
+
+		// '\0' terminated, without separators between strings
+		static constexpr const char* data() noexcept { return storage::blob.data(); }
+		static constexpr std::size_t blob_size() noexcept { return storage::blob.size() - 1; }
+
+		// refs of Strs, in order
+		static constexpr std::array<ref_type, sizeof...(Strs)> refs = [] {
+			std::array<ref_type, sizeof...(Strs)> rst{};
+			for (std::size_t i = 0; i < sizeof...(Strs); i++)
+				rst[i] = { storage::layout.offsets[i], static_cast<std::uint32_t>(storage::strs[i].size()) };
+			return rst;
+		}();
+
+		template<std::size_t Index>
+		static constexpr ref_type ref = refs[Index];
+
+		static constexpr std::string_view view(std::size_t index) noexcept {
+			assert(index < size());
+			return refs[index];
+		}
+
+		// ref of the first string equal to str, if any
+		static constexpr std::optional<ref_type> find(std::string_view str) noexcept {
+			for (const auto& r : refs) {
+				if (r.view() == str)
+					return r;
+			}
+			return std::nullopt;
+		}
+	};
+}
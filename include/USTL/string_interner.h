@@ -0,0 +1,97 @@
+#pragma once
+
+#include "cstring.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string_view>
+
+#include "details/string_interner.inl"
+
+namespace Ubpa::USTL {
+	struct interned_string {
+		std::uint64_t id; // string_hash(str)
+		std::string_view str; // valid as long as the interner
+	};
+
+	// concurrent string pool
+	// - strings are copied once into per-shard arenas, views never dangle or move
+	// - reads (find, intern of a known string) take no lock
+	// - writes lock one of shard_count shards, picked by the id
+	// - ids are string_hash, so the id of a literal is known at compile time: id_of("tag")
+	// distinct strings with the same 64-bit id are all interned, find(id) returns one of them
+	class string_interner {
+	public:
+		static constexpr std::size_t shard_bits = 5;
+		static constexpr std::size_t shard_count = std::size_t{ 1 } << shard_bits;
+
+		string_interner() = default;
+		string_interner(const string_interner&) = delete;
+		string_interner& operator=(const string_interner&) = delete;
+
+		static constexpr std::uint64_t id_of(std::string_view str) noexcept { return string_hash(str); }
+
+		interned_string intern(std::string_view str) {
+			const std::uint64_t id = id_of(str);
+			auto& shard = shard_of(id);
+			if (const auto* e = shard.table.load(std::memory_order_acquire)->find(id, str))
+				return { e->id, e->str };
+
+			std::lock_guard<std::mutex> lock{ shard.mutex };
+			details::interner_table* table = shard.tables.back().get();
+			if (const auto* e = table->find(id, str))
+				return { e->id, e->str };
+
+			// keep the load factor <= 1/2
+			if (2 * (shard.count + 1) > table->mask + 1)
+				table = grow(shard);
+
+			const details::interner_entry* e = shard.arena.create(id, str);
+			table->insert(e);
+			shard.count++;
+			size_.fetch_add(1, std::memory_order_relaxed);
+			return { e->id, e->str };
+		}
+
+		// lock-free
+		std::optional<interned_string> find(std::string_view str) const noexcept {
+			const std::uint64_t id = id_of(str);
+			if (const auto* e = shard_of(id).table.load(std::memory_order_acquire)->find(id, str))
+				return interned_string{ e->id, e->str };
+			return std::nullopt;
+		}
+
+		// lock-free
+		std::optional<std::string_view> find(std::uint64_t id) const noexcept {
+			if (const auto* e = shard_of(id).table.load(std::memory_order_acquire)->find(id))
+				return e->str;
+			return std::nullopt;
+		}
+
+		std::size_t size() const noexcept { return size_.load(std::memory_order_relaxed); }
+
+	private:
+		// the table index uses the low bits of the id, the shard the high ones
+		details::interner_shard& shard_of(std::uint64_t id) noexcept { return shards_[id >> (64 - shard_bits)]; }
+		const details::interner_shard& shard_of(std::uint64_t id) const noexcept { return shards_[id >> (64 - shard_bits)]; }
+
+		// the old table stays alive for readers still probing it
+		static details::interner_table* grow(details::interner_shard& shard) {
+			const details::interner_table& old = *shard.tables.back();
+			auto* table = shard.tables.emplace_back(std::make_unique<details::interner_table>(2 * (old.mask + 1))).get();
+			for (std::size_t i = 0; i <= old.mask; i++) {
+				if (const auto* e = old.slots[i].load(std::memory_order_relaxed))
+					table->insert(e);
+			}
+			shard.table.store(table, std::memory_order_release);
+			return table;
+		}
+
+		std::array<details::interner_shard, shard_count> shards_;
+		std::atomic<std::size_t> size_{ 0 };
+	};
+}
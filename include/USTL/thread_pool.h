@@ -0,0 +1,171 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "details/thread_pool.inl"
+
+namespace Ubpa::USTL {
+	// [executor]
+	// void fork_join(std::size_t n, Func&& f): calls f(0), ..., f(n - 1), maybe concurrently, and returns when all are done
+	// the first exception thrown by f is rethrown after the join
+
+	// runs everything on the calling thread, in order
+	struct inline_executor {
+		template<typename Func>
+		void fork_join(std::size_t n, Func&& f) {
+			for (std::size_t i = 0; i < n; i++)
+				f(i);
+		}
+	};
+
+	// work-stealing pool, one task queue per worker
+	// - fork_join pushes n - 1 tasks, runs f(0) itself, then helps with queued tasks until the join
+	//   so nested fork_join from inside a task does not deadlock
+	// - a worker pops its own queue LIFO, and steals FIFO from the others when it runs dry
+	class thread_pool {
+	public:
+		explicit thread_pool(std::size_t thread_count = default_thread_count())
+			: queues_(thread_count + 1) // the last one takes tasks pushed from outside the pool
+		{
+			for (auto& queue : queues_)
+				queue = std::make_unique<details::pool_task_queue>();
+			threads_.reserve(thread_count);
+			for (std::size_t i = 0; i < thread_count; i++)
+				threads_.emplace_back([this, i] { work(i); });
+		}
+
+		thread_pool(const thread_pool&) = delete;
+		thread_pool& operator=(const thread_pool&) = delete;
+
+		// waits for the queued tasks
+		~thread_pool() {
+			{
+				std::lock_guard<std::mutex> lock{ sleep_mutex_ };
+				stop_ = true;
+			}
+			sleep_cv_.notify_all();
+			for (auto& thread : threads_)
+				thread.join();
+		}
+
+		static std::size_t default_thread_count() noexcept {
+			return std::max<std::size_t>(1, std::thread::hardware_concurrency());
+		}
+
+		std::size_t size() const noexcept { return threads_.size(); }
+
+		template<typename Func>
+		void fork_join(std::size_t n, Func&& f) {
+			if (n == 0)
+				return;
+			if (n == 1) {
+				f(std::size_t{ 0 });
+				return;
+			}
+
+			using F = std::remove_reference_t<Func>;
+			struct join_state {
+				F* f;
+				std::atomic<std::size_t> pending;
+				std::mutex error_mutex;
+				std::exception_ptr error;
+			} state{ &f, n - 1, {}, nullptr };
+
+			auto run = [](void* context, std::size_t index) {
+				auto& s = *static_cast<join_state*>(context);
+				try {
+					(*s.f)(index);
+				}
+				catch (...) {
+					std::lock_guard<std::mutex> lock{ s.error_mutex };
+					if (!s.error)
+						s.error = std::current_exception();
+				}
+				s.pending.fetch_sub(1, std::memory_order_acq_rel); // last access to s
+			};
+
+			// pushed backwards so the owner pops 1, 2, ... and thieves take the far end
+			auto& queue = *queues_[self()];
+			for (std::size_t i = n - 1; i > 0; i--)
+				queue.push({ +run, &state, i });
+			notify(n - 1);
+
+			try {
+				f(std::size_t{ 0 });
+			}
+			catch (...) {
+				std::lock_guard<std::mutex> lock{ state.error_mutex };
+				if (!state.error)
+					state.error = std::current_exception();
+			}
+
+			while (state.pending.load(std::memory_order_acquire) != 0) {
+				if (!run_one(self()))
+					std::this_thread::yield();
+			}
+
+			if (state.error)
+				std::rethrow_exception(state.error);
+		}
+
+	private:
+		// worker index, or the shared queue for other threads
+		std::size_t self() const noexcept { return current_pool == this ? current_index : threads_.size(); }
+
+		void notify(std::size_t count) {
+			queued_.fetch_add(count, std::memory_order_release);
+			{
+				std::lock_guard<std::mutex> lock{ sleep_mutex_ };
+			}
+			if (count == 1)
+				sleep_cv_.notify_one();
+			else
+				sleep_cv_.notify_all();
+		}
+
+		bool run_one(std::size_t self) {
+			details::pool_task task;
+			bool found = queues_[self]->pop(task);
+			for (std::size_t k = 1; !found && k < queues_.size(); k++)
+				found = queues_[(self + k) % queues_.size()]->steal(task);
+			if (!found)
+				return false;
+			queued_.fetch_sub(1, std::memory_order_relaxed);
+			task.run(task.context, task.index);
+			return true;
+		}
+
+		void work(std::size_t index) {
+			current_pool = this;
+			current_index = index;
+			for (;;) {
+				if (run_one(index))
+					continue;
+				std::unique_lock<std::mutex> lock{ sleep_mutex_ };
+				sleep_cv_.wait(lock, [this] { return stop_ || queued_.load(std::memory_order_acquire) != 0; });
+				if (stop_ && queued_.load(std::memory_order_acquire) == 0)
+					return;
+			}
+		}
+
+		static inline thread_local const thread_pool* current_pool = nullptr;
+		static inline thread_local std::size_t current_index = 0;
+
+		std::vector<std::unique_ptr<details::pool_task_queue>> queues_;
+		std::vector<std::thread> threads_;
+
+		std::atomic<std::size_t> queued_{ 0 };
+		std::mutex sleep_mutex_;
+		std::condition_variable sleep_cv_;
+		bool stop_{ false };
+	};
+}
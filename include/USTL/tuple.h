@@ -1,6 +1,9 @@
 #pragma once
 
 #include <tuple>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
 
 namespace Ubpa::USTL {
 	template<bool... Masks, typename Tuple, typename Init, typename Func>
@@ -9,12 +12,21 @@ namespace Ubpa::USTL {
 	template<bool... Masks, typename Tuple, typename Func>
 	constexpr void tuple_for_each(Tuple&&, Func&&);
 
+	template<typename Tuple, typename Func>
+	void tuple_for_each_mask(Tuple&&, std::uint64_t, Func&&);
+
+	template<typename Tuple, typename Init, typename Func>
+	std::decay_t<Init> tuple_accumulate_mask(Tuple&&, std::uint64_t, Init&&, Func&&);
+
 	template<typename Tuple, typename Func>
 	constexpr size_t tuple_find_if(const Tuple&, Func&&);
 
 	template<typename Tuple, typename Elem>
 	constexpr size_t tuple_find(const Tuple&, const Elem&);
 
+	template<typename Tuple, typename Func>
+	constexpr decltype(auto) tuple_visit_at(Tuple&&, size_t, Func&&);
+
 	template<typename Tuple, typename Elem>
 	constexpr bool tuple_constains(const Tuple&, const Elem&);
 
@@ -32,3 +44,17 @@ namespace Ubpa::USTL {
 }
 
 #include "details/tuple.inl"
+
+namespace Ubpa::USTL {
+	// index of the first element whose type is exactly T (as std::get<T>), -1 if none
+	template<typename T, typename Tuple>
+	constexpr size_t tuple_index_of_type = details::tuple_type_indices<T, std::remove_cv_t<std::remove_reference_t<Tuple>>, false>::first;
+
+	// number of elements whose type is exactly T
+	template<typename T, typename Tuple>
+	constexpr size_t tuple_count_type = details::tuple_type_indices<T, std::remove_cv_t<std::remove_reference_t<Tuple>>, false>::count;
+
+	// std::index_sequence of the indices of the elements whose type is exactly T
+	template<typename T, typename Tuple>
+	using tuple_indices_of_type = typename details::tuple_type_indices<T, std::remove_cv_t<std::remove_reference_t<Tuple>>, false>::type;
+}
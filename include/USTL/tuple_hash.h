@@ -0,0 +1,40 @@
+#pragma once
+
+#include "tuple_serialize.h"
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "details/tuple_hash.inl"
+
+namespace Ubpa::USTL {
+	// hasher for tuple-like keys, e.g. std::unordered_map<std::tuple<...>, V, tuple_hash, tuple_equal>
+	// - adjacent elements whose equal values have equal bytes (integers, enums, pointers, padding-free structs)
+	//   are hashed as one block in a single pass
+	// - std::string / std::string_view hash their characters, so tuple<std::string> and
+	//   tuple<std::string_view> keys with equal contents hash equally
+	// - other elements go through std::hash and are mixed in
+	// heterogeneous keys otherwise need the same element types
+	struct tuple_hash {
+		using is_transparent = void;
+
+		template<typename Tuple>
+		std::size_t operator()(const Tuple& t) const {
+			return static_cast<std::size_t>(details::tuple_hash(t,
+				std::make_index_sequence<details::hash_plan_of<Tuple>::run_count>{}));
+		}
+	};
+
+	// element-wise ==, transparent
+	struct tuple_equal {
+		using is_transparent = void;
+
+		template<typename L, typename R>
+		constexpr bool operator()(const L& lhs, const R& rhs) const {
+			static_assert(std::tuple_size_v<L> == std::tuple_size_v<R>);
+			return details::tuple_equal(lhs, rhs, std::make_index_sequence<std::tuple_size_v<L>>{});
+		}
+	};
+}
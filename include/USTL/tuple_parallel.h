@@ -0,0 +1,109 @@
+#pragma once
+
+#include "thread_pool.h"
+#include "tuple.h"
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace Ubpa::USTL::details {
+	// indices of the elements enabled by Masks... (padded with true)
+	template<std::size_t N, bool... Masks>
+	constexpr auto tuple_enabled_indices_() noexcept {
+		constexpr std::size_t count = [] {
+			std::size_t n = 0;
+			for (std::size_t i = 0; i < N; i++)
+				n += tuple_mask_at<Masks...>(i);
+			return n;
+		}();
+		std::array<std::size_t, count> indices{};
+		for (std::size_t i = 0, k = 0; i < N; i++) {
+			if (tuple_mask_at<Masks...>(i))
+				indices[k++] = i;
+		}
+		return indices;
+	}
+
+	template<std::size_t N, bool... Masks>
+	constexpr auto tuple_enabled_indices = tuple_enabled_indices_<N, Masks...>();
+
+	// f(get<tuple_enabled_indices[k]>(t)) through a table over the enabled elements only,
+	// so f is never instantiated for a masked-out element
+	template<std::size_t N, bool... Masks, typename Tuple, typename Func, std::size_t... Ks>
+	void tuple_visit_enabled(Tuple&& t, std::size_t k, Func&& f, std::index_sequence<Ks...>) {
+		using Visitor = void(*)(Tuple&&, Func&&);
+		static constexpr Visitor visitors[] = {
+			&tuple_visit_at_<tuple_enabled_indices<N, Masks...>[Ks], void, Tuple, Func>...
+		};
+		visitors[k](std::forward<Tuple>(t), std::forward<Func>(f));
+	}
+}
+
+namespace Ubpa::USTL {
+	// tuple_for_each with one task per (enabled) element on executor, returns after all of them
+	// f must be safe to call concurrently on different elements
+	template<bool... Masks, typename Tuple, typename Func, typename Executor>
+	void tuple_for_each_parallel(Tuple&& t, Func&& f, Executor& executor) {
+		constexpr std::size_t N = std::tuple_size_v<std::decay_t<Tuple>>;
+		static_assert(sizeof...(Masks) <= N);
+		constexpr std::size_t count = details::tuple_enabled_indices<N, Masks...>.size();
+		if constexpr (count > 0) {
+			executor.fork_join(count, [&](std::size_t k) {
+				// each element is visited once, so forwarding an rvalue tuple moves every element at most once
+				details::tuple_visit_enabled<N, Masks...>(std::forward<Tuple>(t), k, [&](auto&& elem) {
+					f(std::forward<decltype(elem)>(elem));
+				}, std::make_index_sequence<count>{});
+			});
+		}
+	}
+
+	// reduce(init, reduce(transform(e0), reduce(transform(e1), ...))) over the enabled elements
+	// - transform runs as one task per element
+	// - the results are combined pairwise as a balanced tree, neighbours only, so reduce has to be
+	//   associative but not commutative
+	// T = std::decay_t<Init>, transform(elem) -> T, reduce(T, T) -> T
+	template<bool... Masks, typename Tuple, typename Init, typename Reduce, typename Transform, typename Executor>
+	auto tuple_accumulate_parallel(Tuple&& t, Init&& init, Reduce&& reduce, Transform&& transform, Executor& executor) {
+		using T = std::decay_t<Init>;
+		constexpr std::size_t N = std::tuple_size_v<std::decay_t<Tuple>>;
+		static_assert(sizeof...(Masks) <= N);
+		constexpr std::size_t count = details::tuple_enabled_indices<N, Masks...>.size();
+
+		T result(std::forward<Init>(init));
+		if constexpr (count > 0) {
+			std::array<std::optional<T>, count> partial;
+			executor.fork_join(count, [&](std::size_t k) {
+				details::tuple_visit_enabled<N, Masks...>(std::forward<Tuple>(t), k, [&](auto&& elem) {
+					partial[k].emplace(transform(std::forward<decltype(elem)>(elem)));
+				}, std::make_index_sequence<count>{});
+			});
+
+			// level with stride s: partial[i] = reduce(partial[i], partial[i + s]) for i % 2s == 0
+			for (std::size_t stride = 1; stride < count; stride *= 2) {
+				const std::size_t pairs = (count - stride + 2 * stride - 1) / (2 * stride);
+				executor.fork_join(pairs, [&](std::size_t p) {
+					const std::size_t i = 2 * stride * p;
+					partial[i].emplace(reduce(std::move(*partial[i]), std::move(*partial[i + stride])));
+				});
+			}
+			result = reduce(std::move(result), std::move(*partial[0]));
+		}
+		return result;
+	}
+
+	// transform is the identity (T constructible from every element)
+	template<bool... Masks, typename Tuple, typename Init, typename Reduce, typename Executor>
+	auto tuple_accumulate_parallel(Tuple&& t, Init&& init, Reduce&& reduce, Executor& executor) {
+		using T = std::decay_t<Init>;
+		return tuple_accumulate_parallel<Masks...>(
+			std::forward<Tuple>(t),
+			std::forward<Init>(init),
+			std::forward<Reduce>(reduce),
+			[](auto&& elem) { return T(std::forward<decltype(elem)>(elem)); },
+			executor
+		);
+	}
+}
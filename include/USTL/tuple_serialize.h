@@ -0,0 +1,76 @@
+#pragma once
+
+#include "output_sink.h"
+#include "tuple.h"
+
+#include <cstddef>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "details/tuple_serialize.inl"
+
+namespace Ubpa::USTL {
+	// binary encoding of the elements in order, no header and no padding
+	// - trivially copyable elements: object representation (native endian)
+	// - serialize_format::varint: integers wider than a byte as LEB128, signed ones zigzagged
+	// - std::string, std::string_view, std::vector<trivially copyable>: varint size, then the elements
+	// adjacent raw elements form a run whose size is known at compile time,
+	// a run is written as one block and bounds-checked once when reading
+	template<typename Tuple>
+	constexpr bool is_serializable_tuple_v = details::is_serializable_tuple<Tuple>::value;
+
+	// the zero-copy target of tuple_deserialize: std::string becomes std::string_view
+	template<typename Tuple>
+	using tuple_deserialize_view_t = typename details::tuple_deserialize_view<Tuple>::type;
+
+	template<serialize_format Format = serialize_format::raw, typename Tuple>
+	std::size_t tuple_serialized_size(const Tuple& t) noexcept {
+		static_assert(is_serializable_tuple_v<Tuple>);
+		return details::tuple_serialized_size<Format>(t,
+			std::make_index_sequence<details::serialize_plan_of<Format, Tuple>::run_count>{});
+	}
+
+	// out must hold tuple_serialized_size(t) bytes, returns the end of the written bytes
+	template<serialize_format Format = serialize_format::raw, typename Tuple>
+	char* tuple_serialize(const Tuple& t, char* out) noexcept {
+		static_assert(is_serializable_tuple_v<Tuple>);
+		return details::tuple_serialize<Format>(out, t,
+			std::make_index_sequence<details::serialize_plan_of<Format, Tuple>::run_count>{});
+	}
+
+	// appends to buffer, grows it once
+	template<serialize_format Format = serialize_format::raw, typename Tuple>
+	void tuple_serialize(const Tuple& t, std::vector<char>& buffer) {
+		const std::size_t offset = buffer.size();
+		buffer.resize(offset + tuple_serialized_size<Format>(t));
+		tuple_serialize<Format>(t, buffer.data() + offset);
+	}
+
+	// fixed_buffer_writer or output_sink, see their overflow / error reporting
+	template<serialize_format Format = serialize_format::raw, typename Tuple, typename Sink,
+		std::enable_if_t<details::is_output_sink_v<Sink>, int> = 0>
+	void tuple_serialize(const Tuple& t, Sink& sink) {
+		static_assert(is_serializable_tuple_v<Tuple>);
+		details::tuple_serialize_to<Format>(sink, t,
+			std::make_index_sequence<details::serialize_plan_of<Format, Tuple>::run_count>{});
+	}
+
+	// reads the elements of t from [first, last)
+	// returns the end of the consumed bytes, nullptr if the input is truncated or malformed
+	// std::string_view elements point into the input (zero-copy, see tuple_deserialize_view_t),
+	// raw bytes are not validated, only deserialize trusted input into bool / enum elements
+	template<serialize_format Format = serialize_format::raw, typename Tuple>
+	const char* tuple_deserialize(const char* first, const char* last, Tuple& t) {
+		static_assert(is_serializable_tuple_v<Tuple>);
+		return details::tuple_deserialize<Format>(first, last, t,
+			std::make_index_sequence<details::serialize_plan_of<Format, Tuple>::run_count>{});
+	}
+
+	template<serialize_format Format = serialize_format::raw, typename Tuple>
+	const char* tuple_deserialize(std::string_view input, Tuple& t) {
+		return tuple_deserialize<Format>(input.data(), input.data() + input.size(), t);
+	}
+}
@@ -0,0 +1,165 @@
+#pragma once
+
+#include "tuple.h"
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "details/tuple_view.inl"
+
+namespace Ubpa::USTL {
+	// [lazy tuple views]
+	// tuple-likes (std::tuple_size, std::tuple_element, get) over other tuples, nothing is copied
+	// - get forwards to the viewed element (or computes it, for tuple_transform_view)
+	// - the tuple.h algorithms and structured bindings work on them unchanged
+	// - tuple_materialize builds a std::tuple when one is needed
+	// lvalue tuples are referenced (shallow const, like a span), rvalue tuples are moved into the view
+
+	// the elements of Tuples..., one after another
+	template<typename... Tuples>
+	class tuple_concat_view {
+		using indices = details::tuple_concat_indices<Tuples...>;
+		template<std::size_t I>
+		using base_t = std::tuple_element_t<indices::outer(I), std::tuple<Tuples...>>;
+	public:
+		constexpr explicit tuple_concat_view(Tuples... ts) : bases_{ std::forward<Tuples>(ts)... } {}
+
+		static constexpr std::size_t size() noexcept { return indices::size; }
+
+		template<std::size_t I>
+		constexpr decltype(auto) get() & noexcept {
+			return details::tuple_get<indices::inner(I)>(std::get<indices::outer(I)>(bases_));
+		}
+		template<std::size_t I>
+		constexpr decltype(auto) get() const& noexcept {
+			return details::tuple_get<indices::inner(I)>(std::get<indices::outer(I)>(bases_));
+		}
+		template<std::size_t I>
+		constexpr decltype(auto) get() && noexcept {
+			return details::tuple_get<indices::inner(I)>(std::get<indices::outer(I)>(std::move(bases_)));
+		}
+
+		template<std::size_t I>
+		using element_type = std::tuple_element_t<indices::inner(I), std::remove_reference_t<base_t<I>>>;
+
+	private:
+		std::tuple<Tuples...> bases_;
+	};
+
+	// elements [Begin, End) of Tuple
+	template<std::size_t Begin, std::size_t End, typename Tuple>
+	class tuple_slice_view {
+		static_assert(Begin <= End && End <= std::tuple_size_v<std::remove_reference_t<Tuple>>);
+	public:
+		constexpr explicit tuple_slice_view(Tuple t) : base_{ std::forward<Tuple>(t) } {}
+
+		static constexpr std::size_t size() noexcept { return End - Begin; }
+
+		template<std::size_t I>
+		constexpr decltype(auto) get() & noexcept { return details::tuple_get<Begin + I>(base_); }
+		template<std::size_t I>
+		constexpr decltype(auto) get() const& noexcept { return details::tuple_get<Begin + I>(base_); }
+		template<std::size_t I>
+		constexpr decltype(auto) get() && noexcept { return details::tuple_get<Begin + I>(static_cast<Tuple&&>(base_)); }
+
+		template<std::size_t I>
+		using element_type = std::tuple_element_t<Begin + I, std::remove_reference_t<Tuple>>;
+
+	private:
+		Tuple base_;
+	};
+
+	// f(get<I>(tuple)), computed on each get
+	template<typename Tuple, typename Func>
+	class tuple_transform_view {
+	public:
+		constexpr tuple_transform_view(Tuple t, Func f) : base_{ std::forward<Tuple>(t) }, f_{ std::move(f) } {}
+
+		static constexpr std::size_t size() noexcept { return std::tuple_size_v<std::remove_reference_t<Tuple>>; }
+
+		template<std::size_t I>
+		constexpr decltype(auto) get() & { return f_(details::tuple_get<I>(base_)); }
+		template<std::size_t I>
+		constexpr decltype(auto) get() const& { return f_(details::tuple_get<I>(base_)); }
+		template<std::size_t I>
+		constexpr decltype(auto) get() && { return f_(details::tuple_get<I>(static_cast<Tuple&&>(base_))); }
+
+		template<std::size_t I>
+		using element_type = decltype(std::declval<Func&>()(details::tuple_get<I>(std::declval<std::remove_reference_t<Tuple>&>())));
+
+	private:
+		Tuple base_;
+		Func f_;
+	};
+
+	template<typename... Tuples>
+	constexpr auto tuple_concat(Tuples&&... ts) {
+		return tuple_concat_view<details::tuple_view_base_t<Tuples&&>...>{ std::forward<Tuples>(ts)... };
+	}
+
+	template<std::size_t Begin, std::size_t End, typename Tuple>
+	constexpr auto tuple_slice(Tuple&& t) {
+		return tuple_slice_view<Begin, End, details::tuple_view_base_t<Tuple&&>>{ std::forward<Tuple>(t) };
+	}
+
+	template<typename Tuple, typename Func>
+	constexpr auto tuple_transform(Tuple&& t, Func&& f) {
+		return tuple_transform_view<details::tuple_view_base_t<Tuple&&>, std::decay_t<Func>>{ std::forward<Tuple>(t), std::forward<Func>(f) };
+	}
+
+	namespace details {
+		template<typename Tuple, std::size_t... Ns>
+		constexpr auto tuple_materialize(Tuple&& t, std::index_sequence<Ns...>) {
+			return std::tuple<std::decay_t<decltype(tuple_get<Ns>(std::forward<Tuple>(t)))>...>{
+				tuple_get<Ns>(std::forward<Tuple>(t))...
+			};
+		}
+	}
+
+	// std::tuple of the (decayed) elements of any tuple-like
+	template<typename Tuple>
+	constexpr auto tuple_materialize(Tuple&& t) {
+		return details::tuple_materialize(std::forward<Tuple>(t),
+			std::make_index_sequence<std::tuple_size_v<std::remove_reference_t<Tuple>>>{});
+	}
+
+	namespace details {
+		template<typename T> struct is_tuple_view : std::false_type {};
+		template<typename... Tuples> struct is_tuple_view<tuple_concat_view<Tuples...>> : std::true_type {};
+		template<std::size_t Begin, std::size_t End, typename Tuple> struct is_tuple_view<tuple_slice_view<Begin, End, Tuple>> : std::true_type {};
+		template<typename Tuple, typename Func> struct is_tuple_view<tuple_transform_view<Tuple, Func>> : std::true_type {};
+	}
+
+	// found by ADL (structured bindings use the members), the tuple.h algorithms look for both
+	template<std::size_t I, typename View, std::enable_if_t<details::is_tuple_view<std::remove_cv_t<std::remove_reference_t<View>>>::value, int> = 0>
+	constexpr decltype(auto) get(View&& view) {
+		return std::forward<View>(view).template get<I>();
+	}
+}
+
+namespace std {
+	template<typename... Tuples>
+	struct tuple_size<Ubpa::USTL::tuple_concat_view<Tuples...>>
+		: integral_constant<size_t, Ubpa::USTL::tuple_concat_view<Tuples...>::size()> {};
+	template<size_t Begin, size_t End, typename Tuple>
+	struct tuple_size<Ubpa::USTL::tuple_slice_view<Begin, End, Tuple>> : integral_constant<size_t, End - Begin> {};
+	template<typename Tuple, typename Func>
+	struct tuple_size<Ubpa::USTL::tuple_transform_view<Tuple, Func>>
+		: integral_constant<size_t, Ubpa::USTL::tuple_transform_view<Tuple, Func>::size()> {};
+
+	template<size_t I, typename... Tuples>
+	struct tuple_element<I, Ubpa::USTL::tuple_concat_view<Tuples...>> {
+		using type = typename Ubpa::USTL::tuple_concat_view<Tuples...>::template element_type<I>;
+	};
+	template<size_t I, size_t Begin, size_t End, typename Tuple>
+	struct tuple_element<I, Ubpa::USTL::tuple_slice_view<Begin, End, Tuple>> {
+		using type = typename Ubpa::USTL::tuple_slice_view<Begin, End, Tuple>::template element_type<I>;
+	};
+	template<size_t I, typename Tuple, typename Func>
+	struct tuple_element<I, Ubpa::USTL::tuple_transform_view<Tuple, Func>> {
+		using type = typename Ubpa::USTL::tuple_transform_view<Tuple, Func>::template element_type<I>;
+	};
+
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "cstring.h"
+
+#include <cstdint>
+
+#include "details/type_name.inl"
+
+namespace Ubpa::USTL {
+	// compile-time name of T, extracted from __PRETTY_FUNCTION__ / __FUNCSIG__
+	// normalized across compilers:
+	// - no class/struct/enum/union keywords
+	// - no inline namespaces (std::__cxx11::, std::__1::)
+	// - spaces only between identifiers, e.g. "std::tuple<int,const char*>"
+	// - builtin integers spelled as Clang does, e.g. "unsigned long"
+	template<typename T>
+	constexpr auto type_name = cstring<details::type_name_storage<T>::size>{
+		std::string_view{ details::type_name_storage<T>::chars.data(), details::type_name_storage<T>::size }
+	};
+
+	// string_hash of type_name<T>
+	template<typename T>
+	constexpr std::uint64_t type_id = string_hash(type_name<T>);
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "cstring.h"
+
+#include <cstddef>
+#include <string_view>
+
+#include "details/utf8.inl"
+
+namespace Ubpa::USTL {
+	// well-formed UTF-8 (no overlong forms, surrogates or code points above U+10FFFF)
+	// runtime inputs skip ASCII runs with SIMD
+	constexpr bool utf8_validate(std::string_view str) noexcept {
+		if (!USTL_IS_CONSTANT_EVALUATED())
+			return details::simd_utf8_validate(str.data(), str.size());
+		return details::utf8_validate(str);
+	}
+
+	// number of code points, str must be valid UTF-8
+	constexpr std::size_t utf8_length(std::string_view str) noexcept {
+		if (!USTL_IS_CONSTANT_EVALUATED())
+			return details::simd_utf8_length(str.data(), str.size());
+		return details::utf8_length(str);
+	}
+
+#ifdef __cpp_char8_t
+	constexpr bool utf8_validate(std::u8string_view str) noexcept {
+		if (!USTL_IS_CONSTANT_EVALUATED())
+			return details::simd_utf8_validate(reinterpret_cast<const char*>(str.data()), str.size());
+		return details::utf8_validate(str);
+	}
+
+	constexpr std::size_t utf8_length(std::u8string_view str) noexcept {
+		if (!USTL_IS_CONSTANT_EVALUATED())
+			return details::simd_utf8_length(reinterpret_cast<const char*>(str.data()), str.size());
+		return details::utf8_length(str);
+	}
+#endif
+}
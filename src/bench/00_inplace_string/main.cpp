@@ -0,0 +1,73 @@
+#include <USTL/cstring.h>
+
+#include "../do_not_optimize.h"
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace Ubpa::USTL;
+using namespace std;
+
+template<typename Func>
+double time_ms(Func&& f) {
+	auto begin = chrono::steady_clock::now();
+	f();
+	auto end = chrono::steady_clock::now();
+	return chrono::duration<double, milli>(end - begin).count();
+}
+
+vector<string> make_keys(size_t count, size_t length) {
+	mt19937 rng{ 0 };
+	vector<string> keys;
+	keys.reserve(count);
+	for (size_t i = 0; i < count; i++) {
+		string key(length, 'a');
+		for (auto& c : key)
+			c = static_cast<char>('a' + rng() % 26);
+		keys.push_back(move(key));
+	}
+	return keys;
+}
+
+template<typename Map, typename Key>
+double bench_map(const vector<string>& keys, size_t rounds) {
+	Map m;
+	vector<Key> queries;
+	for (size_t i = 0; i < keys.size(); i++) {
+		m.emplace(Key{ string_view{ keys[i] } }, i);
+		queries.emplace_back(string_view{ keys[i] });
+	}
+	size_t sum = 0;
+	double t = time_ms([&] {
+		for (size_t r = 0; r < rounds; r++) {
+			for (const auto& q : queries)
+				sum += m.find(q)->second;
+		}
+	});
+	do_not_optimize(sum);
+	return t;
+}
+
+template<size_t Length>
+void bench() {
+	constexpr size_t count = 1 << 14;
+	constexpr size_t rounds = 32;
+	const auto keys = make_keys(count, Length);
+	cout << "key length " << Length << endl
+		<< "  unordered_map<string>        : " << bench_map<unordered_map<string, size_t>, string>(keys, rounds) << " ms" << endl
+		<< "  unordered_map<inplace_string>: " << bench_map<unordered_map<inplace_string<64>, size_t>, inplace_string<64>>(keys, rounds) << " ms" << endl
+		<< "  map<string>                  : " << bench_map<map<string, size_t>, string>(keys, rounds) << " ms" << endl
+		<< "  map<inplace_string>          : " << bench_map<map<inplace_string<64>, size_t, less<>>, inplace_string<64>>(keys, rounds) << " ms" << endl;
+}
+
+int main() {
+	bench<8>();
+	bench<16>();
+	bench<32>();
+	bench<64>();
+}
@@ -0,0 +1,58 @@
+#include <USTL/charconv.h>
+
+#include "../do_not_optimize.h"
+
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace Ubpa::USTL;
+using namespace std;
+
+template<typename Func>
+double time_ms(Func&& f) {
+	auto begin = chrono::steady_clock::now();
+	f();
+	auto end = chrono::steady_clock::now();
+	return chrono::duration<double, milli>(end - begin).count();
+}
+
+template<typename T, size_t Base>
+void bench(const char* name) {
+	mt19937_64 rng{ 0 };
+	vector<T> values(1 << 20);
+	for (auto& v : values)
+		v = static_cast<T>(rng() >> (rng() % 64));
+
+	char buffer[128];
+	size_t total = 0;
+	const double t_ustl = time_ms([&] {
+		for (auto v : values)
+			total += write_integer<Base>(buffer, v) - buffer;
+	});
+	const double t_to_chars = time_ms([&] {
+		for (auto v : values)
+			total += to_chars(buffer, buffer + sizeof(buffer), v, static_cast<int>(Base)).ptr - buffer;
+	});
+	const char* format = Base == 16 ? "%llX" : "%lld";
+	const double t_snprintf = time_ms([&] {
+		for (auto v : values)
+			total += snprintf(buffer, sizeof(buffer), format, static_cast<long long>(v));
+	});
+	do_not_optimize(total);
+
+	cout << name << " (" << values.size() << " values)" << endl
+		<< "  write_integer: " << t_ustl << " ms" << endl
+		<< "  to_chars     : " << t_to_chars << " ms" << endl
+		<< "  snprintf     : " << t_snprintf << " ms" << endl;
+}
+
+int main() {
+	bench<int32_t, 10>("int32_t, base 10");
+	bench<int64_t, 10>("int64_t, base 10");
+	bench<uint64_t, 16>("uint64_t, base 16");
+}
@@ -0,0 +1,58 @@
+#include <USTL/charconv.h>
+
+#include "../do_not_optimize.h"
+
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Ubpa::USTL;
+using namespace std;
+
+template<typename Func>
+double time_ms(Func&& f) {
+	auto begin = chrono::steady_clock::now();
+	f();
+	auto end = chrono::steady_clock::now();
+	return chrono::duration<double, milli>(end - begin).count();
+}
+
+// values are random bits shifted right by [min_shift, max_shift)
+template<typename T>
+void bench(const char* name, unsigned min_shift, unsigned max_shift) {
+	mt19937_64 rng{ 0 };
+	vector<string> strs(1 << 20);
+	for (auto& s : strs)
+		s = to_string(static_cast<T>(rng() >> (min_shift + rng() % (max_shift - min_shift))));
+
+	// warm up so neither side pays for the first pass over the strings
+	T total = 0;
+	for (const auto& s : strs)
+		total += static_cast<T>(s.size());
+	const double t_ustl = time_ms([&] {
+		for (const auto& s : strs)
+			total += parse_integer<T>(s, 10).value;
+	});
+	const double t_from_chars = time_ms([&] {
+		for (const auto& s : strs) {
+			T value{};
+			from_chars(s.data(), s.data() + s.size(), value);
+			total += value;
+		}
+	});
+	do_not_optimize(total);
+
+	cout << name << " (" << strs.size() << " strings)" << endl
+		<< "  parse_integer: " << t_ustl << " ms" << endl
+		<< "  from_chars   : " << t_from_chars << " ms" << endl;
+}
+
+int main() {
+	bench<uint32_t>("uint32_t, up to 10 digits", 32, 64);
+	bench<uint64_t>("uint64_t, up to 20 digits", 0, 64);
+	bench<uint64_t>("uint64_t, 16-20 digits", 0, 12);
+}
@@ -0,0 +1,68 @@
+#include <USTL/pattern.h>
+
+#include "../do_not_optimize.h"
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <regex>
+#include <string>
+#include <vector>
+
+using namespace Ubpa::USTL;
+using namespace std;
+
+template<typename Func>
+double time_ms(Func&& f) {
+	auto begin = chrono::steady_clock::now();
+	f();
+	auto end = chrono::steady_clock::now();
+	return chrono::duration<double, milli>(end - begin).count();
+}
+
+static constexpr cstring glob_pattern{ "user.*.event" };
+static constexpr cstring regex_pattern{ "user\\.[a-z_]+\\.event" };
+
+int main() {
+	const char* words[] = { "user", "order", "login", "logout", "created", "event", "events", "x" };
+	mt19937 rng{ 0 };
+	vector<string> keys(1 << 18);
+	for (auto& key : keys) {
+		key = words[rng() % 8];
+		for (size_t i = rng() % 3 + 1; i > 0; i--) {
+			key += '.';
+			key += words[rng() % 8];
+		}
+	}
+
+	size_t hits = 0;
+	const double t_glob = time_ms([&] {
+		for (const auto& key : keys)
+			hits += static_glob<glob_pattern>::match(key);
+	});
+	const double t_regex = time_ms([&] {
+		for (const auto& key : keys)
+			hits += static_regex<regex_pattern>::match(key);
+	});
+
+	regex std_glob;
+	const double t_std_build = time_ms([&] {
+		std_glob = regex{ "user\\..*\\.event" };
+	});
+	const regex std_regex{ string{ regex_pattern } };
+	const double t_std_glob = time_ms([&] {
+		for (const auto& key : keys)
+			hits += regex_match(key, std_glob);
+	});
+	const double t_std_regex = time_ms([&] {
+		for (const auto& key : keys)
+			hits += regex_match(key, std_regex);
+	});
+	do_not_optimize(hits);
+
+	cout << keys.size() << " keys" << endl
+		<< "  static_glob  " << glob_pattern << " : " << t_glob << " ms" << endl
+		<< "  std::regex   user\\..*\\.event  : " << t_std_glob << " ms (+" << t_std_build << " ms to build)" << endl
+		<< "  static_regex " << regex_pattern << " : " << t_regex << " ms" << endl
+		<< "  std::regex   same pattern      : " << t_std_regex << " ms" << endl;
+}
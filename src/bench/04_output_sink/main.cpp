@@ -0,0 +1,77 @@
+#include <USTL/output_sink.h>
+
+#include "../do_not_optimize.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+using namespace Ubpa::USTL;
+using namespace std;
+
+template<typename Func>
+double time_ms(Func&& f) {
+	auto begin = chrono::steady_clock::now();
+	f();
+	auto end = chrono::steady_clock::now();
+	return chrono::duration<double, milli>(end - begin).count();
+}
+
+#if defined(_WIN32)
+constexpr const char* null_device = "NUL";
+#else
+constexpr const char* null_device = "/dev/null";
+#endif
+
+constexpr cstring key{ "generated_key" };
+constexpr int64_t lines = 1 << 22;
+
+int main() {
+	// "generated_key 123 -456\n" per line
+	const double t_ostream = time_ms([] {
+		ofstream os{ null_device };
+		for (int64_t i = 0; i < lines; i++)
+			os << key << ' ' << i << ' ' << -i << '\n';
+	});
+	const double t_fprintf = time_ms([] {
+		FILE* file = fopen(null_device, "wb");
+		for (int64_t i = 0; i < lines; i++)
+			fprintf(file, "%s %lld %lld\n", key.data(), static_cast<long long>(i), static_cast<long long>(-i));
+		fclose(file);
+	});
+	const double t_sink_file = time_ms([] {
+		FILE* file = fopen(null_device, "wb");
+		{
+			auto sink = output_sink<>::to_file(file);
+			for (int64_t i = 0; i < lines; i++)
+				sink << key << ' ' << i << ' ' << -i << '\n';
+		}
+		fclose(file);
+	});
+	const double t_sink_fd = time_ms([] {
+		FILE* file = fopen(null_device, "wb");
+		{
+			auto sink = output_sink<1 << 16>::to_fd(fileno(file));
+			for (int64_t i = 0; i < lines; i++)
+				sink << key << ' ' << i << ' ' << -i << '\n';
+		}
+		fclose(file);
+	});
+	size_t bytes = 0;
+	auto count = [&](string_view chunk) { bytes += chunk.size(); };
+	const double t_sink_callback = time_ms([&] {
+		output_sink<> sink{ count };
+		for (int64_t i = 0; i < lines; i++)
+			sink << key << ' ' << i << ' ' << -i << '\n';
+	});
+	do_not_optimize(bytes);
+
+	cout << lines << " lines to " << null_device << endl
+		<< "  ostream                : " << t_ostream << " ms" << endl
+		<< "  fprintf                : " << t_fprintf << " ms" << endl
+		<< "  output_sink (FILE*)    : " << t_sink_file << " ms" << endl
+		<< "  output_sink (fd)       : " << t_sink_fd << " ms" << endl
+		<< "  output_sink (callback) : " << t_sink_callback << " ms" << endl;
+}
@@ -0,0 +1,74 @@
+#include <USTL/string_interner.h>
+
+#include "../do_not_optimize.h"
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace Ubpa::USTL;
+using namespace std;
+
+template<typename Func>
+double time_ms(Func&& f) {
+	auto begin = chrono::steady_clock::now();
+	f();
+	auto end = chrono::steady_clock::now();
+	return chrono::duration<double, milli>(end - begin).count();
+}
+
+// the baseline: one map behind one mutex
+class mutex_interner {
+public:
+	uint64_t intern(string_view str) {
+		lock_guard<mutex> lock{ mutex_ };
+		auto [iter, inserted] = ids_.try_emplace(string{ str }, ids_.size());
+		return iter->second;
+	}
+private:
+	mutex mutex_;
+	unordered_map<string, uint64_t> ids_;
+};
+
+template<typename Interner, typename Intern>
+double run(size_t thread_num, const vector<string>& keys, size_t ops, Intern intern) {
+	Interner interner;
+	vector<thread> threads;
+	return time_ms([&] {
+		for (size_t t = 0; t < thread_num; t++) {
+			threads.emplace_back([&, t] {
+				mt19937_64 rng{ t };
+				uint64_t sum = 0;
+				for (size_t i = 0; i < ops; i++)
+					sum += intern(interner, keys[rng() % keys.size()]);
+				do_not_optimize(sum);
+			});
+		}
+		for (auto& th : threads)
+			th.join();
+	});
+}
+
+int main() {
+	vector<string> keys;
+	for (size_t i = 0; i < 100000; i++)
+		keys.push_back("service.request.latency{route=/api/v1/item/" + to_string(i) + "}");
+
+	constexpr size_t ops = 1 << 20;
+	cout << keys.size() << " keys, " << ops << " interns per thread" << endl;
+	for (size_t thread_num : { 1, 2, 4, 8 }) {
+		const double t_mutex = run<mutex_interner>(thread_num, keys, ops,
+			[](mutex_interner& interner, const string& key) { return interner.intern(key); });
+		const double t_ustl = run<string_interner>(thread_num, keys, ops,
+			[](string_interner& interner, const string& key) { return interner.intern(key).id; });
+		cout << "  " << thread_num << " threads" << endl
+			<< "    mutex + unordered_map: " << t_mutex << " ms" << endl
+			<< "    string_interner      : " << t_ustl << " ms" << endl;
+	}
+}
@@ -0,0 +1,69 @@
+// compile-time benchmark: time the build of this file
+// instantiates tuple_accumulate / tuple_for_each / tuple_count_if / tuple_find_if
+// for tuple-likes of 8, 16, ..., USTL_BENCH_MAX_TUPLE_SIZE elements
+// - default: std::array, std::get is O(1) so the algorithms dominate
+// - USTL_BENCH_STD_TUPLE: std::tuple of distinct types, where libstdc++'s std::get dominates
+// e.g. g++ -std=c++17 -fsyntax-only -ftime-report -DUSTL_BENCH_MAX_TUPLE_SIZE=256 main.cpp
+
+#include <USTL/tuple.h>
+
+#include <array>
+#include <cstddef>
+#include <iostream>
+#include <utility>
+
+#ifndef USTL_BENCH_MAX_TUPLE_SIZE
+#define USTL_BENCH_MAX_TUPLE_SIZE 512
+#endif
+
+using namespace Ubpa::USTL;
+using namespace std;
+
+template<size_t N>
+struct component {
+	size_t value;
+};
+
+// libstdc++ checks the converting constructors of std::tuple recursively,
+// which alone exceeds the default depth limit at 512 elements, so only default construct
+template<size_t... Ns>
+auto make_components(index_sequence<Ns...>) -> tuple<component<Ns>...>;
+
+template<size_t N>
+#ifdef USTL_BENCH_STD_TUPLE
+using components = decltype(make_components(make_index_sequence<N>{}));
+#else
+using components = array<component<0>, N>;
+#endif
+
+template<size_t... Ns>
+constexpr auto every_other_mask(index_sequence<Ns...>) {
+	return integer_sequence<bool, Ns % 2 == 0 ...>{};
+}
+
+template<bool... Masks, typename Tuple>
+size_t run(integer_sequence<bool, Masks...>, Tuple& t) {
+	size_t total = tuple_accumulate(t, size_t{ 0 }, [](size_t acc, const auto& c) { return acc + c.value; });
+	total += tuple_accumulate<Masks...>(t, size_t{ 0 }, [](size_t acc, const auto& c) { return acc + c.value; });
+	tuple_for_each<Masks...>(t, [](auto& c) { c.value++; });
+	total += tuple_count_if(t, [](const auto& c) { return c.value % 3 == 0; });
+	total += tuple_find_if(t, [](const auto& c) { return c.value == 7; });
+	return total;
+}
+
+template<size_t N>
+void bench() {
+	if constexpr (N <= USTL_BENCH_MAX_TUPLE_SIZE) {
+		components<N> t;
+		size_t index = 0;
+		tuple_for_each(t, [&](auto& c) { c.value = index++; });
+		static volatile size_t result;
+		result = run(every_other_mask(make_index_sequence<N / 2>{}), t);
+		cout << "size " << N << ": " << result << endl;
+		bench<2 * N>();
+	}
+}
+
+int main() {
+	bench<8>();
+}
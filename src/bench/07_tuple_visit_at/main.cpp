@@ -0,0 +1,76 @@
+#include <USTL/tuple.h>
+
+#include "../do_not_optimize.h"
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace Ubpa::USTL;
+using namespace std;
+
+template<typename Func>
+double time_ms(Func&& f) {
+	auto begin = chrono::steady_clock::now();
+	f();
+	auto end = chrono::steady_clock::now();
+	return chrono::duration<double, milli>(end - begin).count();
+}
+
+template<size_t N>
+struct component {
+	size_t value;
+};
+
+template<size_t... Ns>
+auto make_components(index_sequence<Ns...>) -> tuple<component<Ns>...>;
+
+// the if chain tuple_visit_at replaces
+template<size_t I = 0, typename Tuple, typename Func>
+decltype(auto) linear_visit_at(Tuple& t, size_t index, Func&& f) {
+	if constexpr (I + 1 < tuple_size_v<Tuple>) {
+		if (index == I)
+			return f(get<I>(t));
+		return linear_visit_at<I + 1>(t, index, f);
+	}
+	else
+		return f(get<I>(t));
+}
+
+template<size_t N>
+void bench() {
+	decltype(make_components(make_index_sequence<N>{})) t;
+	size_t value = 0;
+	tuple_for_each(t, [&](auto& c) { c.value = value++; });
+
+	mt19937 rng{ 0 };
+	vector<size_t> indices(1 << 22);
+	for (auto& i : indices)
+		i = rng() % N;
+
+	auto f = [](const auto& c) { return c.value; };
+	size_t total = 0;
+	const double t_linear = time_ms([&] {
+		for (auto i : indices)
+			total += linear_visit_at(t, i, f);
+	});
+	const double t_table = time_ms([&] {
+		for (auto i : indices)
+			total += tuple_visit_at(t, i, f);
+	});
+	do_not_optimize(total);
+
+	cout << "size " << N << " (" << indices.size() << " random visits)" << endl
+		<< "  linear if chain: " << t_linear << " ms" << endl
+		<< "  tuple_visit_at : " << t_table << " ms" << endl;
+}
+
+int main() {
+	bench<4>();
+	bench<16>();
+	bench<64>();
+	bench<256>();
+}
@@ -0,0 +1,82 @@
+#include <USTL/soa_vector.h>
+
+#include "../do_not_optimize.h"
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <tuple>
+#include <vector>
+
+using namespace Ubpa::USTL;
+using namespace std;
+
+template<typename Func>
+double time_ms(Func&& f) {
+	auto begin = chrono::steady_clock::now();
+	f();
+	auto end = chrono::steady_clock::now();
+	return chrono::duration<double, milli>(end - begin).count();
+}
+
+// position, velocity, mass, id, flags
+using particle = tuple<float, float, float, float, double, uint64_t, uint32_t>;
+
+int main() {
+	constexpr size_t n = 1 << 20;
+	constexpr int passes = 50;
+
+	vector<particle> aos;
+	soa_vector<float, float, float, float, double, uint64_t, uint32_t> soa;
+	for (size_t i = 0; i < n; i++) {
+		const particle p{ float(i % 100), float(i % 37), 1.f, -1.f, 1. + i % 3, i, uint32_t(i) };
+		aos.push_back(p);
+		soa.push_back(p);
+	}
+
+	float pos_sum = 0;
+	double mass_sum = 0;
+	const double t_aos = time_ms([&] {
+		for (int k = 0; k < passes; k++) {
+			for (auto& p : aos) {
+				get<0>(p) += get<2>(p) * 0.01f;
+				get<1>(p) += get<3>(p) * 0.01f;
+			}
+			for (const auto& p : aos)
+				mass_sum += get<4>(p);
+		}
+		for (const auto& p : aos)
+			pos_sum += get<0>(p);
+	});
+	const double t_soa = time_ms([&] {
+		for (int k = 0; k < passes; k++) {
+			float* x = soa.column<0>().data();
+			float* y = soa.column<1>().data();
+			const float* vx = soa.column<2>().data();
+			const float* vy = soa.column<3>().data();
+			for (size_t i = 0; i < n; i++) {
+				x[i] += vx[i] * 0.01f;
+				y[i] += vy[i] * 0.01f;
+			}
+			for (double m : soa.column<4>())
+				mass_sum += m;
+		}
+		for (float x : soa.column<0>())
+			pos_sum += x;
+	});
+	const double t_rows = time_ms([&] {
+		for (int k = 0; k < passes; k++) {
+			for (size_t i = 0; i < n; i++) {
+				auto row = soa[i];
+				get<0>(row) += get<2>(row) * 0.01f;
+				get<1>(row) += get<3>(row) * 0.01f;
+			}
+		}
+	});
+	do_not_optimize(pos_sum + mass_sum);
+
+	cout << n << " rows of " << sizeof(particle) << " bytes, " << passes << " passes (x, y += v * dt, sum of mass)" << endl
+		<< "  vector<tuple>     : " << t_aos << " ms" << endl
+		<< "  soa_vector columns: " << t_soa << " ms" << endl
+		<< "  soa_vector rows   : " << t_rows << " ms (update only)" << endl;
+}
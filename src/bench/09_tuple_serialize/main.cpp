@@ -0,0 +1,120 @@
+#include <USTL/tuple_serialize.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+using namespace Ubpa::USTL;
+using namespace std;
+
+template<typename Func>
+double time_ms(Func&& f) {
+	auto begin = chrono::steady_clock::now();
+	f();
+	auto end = chrono::steady_clock::now();
+	return chrono::duration<double, milli>(end - begin).count();
+}
+
+// mixed widths, so the std::tuple layout has padding
+template<size_t I>
+using field = conditional_t<I % 3 == 0, int32_t, conditional_t<I % 3 == 1, double, uint16_t>>;
+
+template<size_t... Is>
+auto make_record(index_sequence<Is...>) -> tuple<field<Is>...>;
+
+// one write / one bounds check per element
+template<typename Sink, typename Tuple>
+void per_element_serialize(const Tuple& t, Sink& sink) {
+	tuple_for_each(t, [&](const auto& e) { sink.write({ reinterpret_cast<const char*>(&e), sizeof(e) }); });
+}
+
+template<typename Tuple>
+const char* per_element_deserialize(const char* first, const char* last, Tuple& t) {
+	tuple_for_each(t, [&](auto& e) {
+		if (first == nullptr || static_cast<size_t>(last - first) < sizeof(e)) {
+			first = nullptr;
+			return;
+		}
+		memcpy(&e, first, sizeof(e));
+		first += sizeof(e);
+	});
+	return first;
+}
+
+template<size_t N>
+void bench() {
+	using record = decltype(make_record(make_index_sequence<N>{}));
+	vector<record> records(1 << 16);
+	size_t value = 0;
+	for (auto& r : records)
+		tuple_for_each(r, [&](auto& e) { e = static_cast<remove_reference_t<decltype(e)>>(value++); });
+
+	constexpr int rounds = 16;
+	vector<char> bytes;
+	auto consume = [&](string_view s) { bytes.insert(bytes.end(), s.begin(), s.end()); };
+
+	const double t_element = time_ms([&] {
+		for (int i = 0; i < rounds; i++) {
+			bytes.clear();
+			output_sink<> sink{ consume };
+			for (const auto& r : records)
+				per_element_serialize(r, sink);
+		}
+	});
+	const double t_sink = time_ms([&] {
+		for (int i = 0; i < rounds; i++) {
+			bytes.clear();
+			output_sink<> sink{ consume };
+			for (const auto& r : records)
+				tuple_serialize(r, sink);
+		}
+	});
+	const double t_buffer = time_ms([&] {
+		for (int i = 0; i < rounds; i++) {
+			bytes.clear();
+			for (const auto& r : records)
+				tuple_serialize(r, bytes);
+		}
+	});
+
+	vector<record> decoded(records.size());
+	const char* last = bytes.data() + bytes.size();
+	const double t_element_read = time_ms([&] {
+		for (int i = 0; i < rounds; i++) {
+			const char* cur = bytes.data();
+			for (auto& r : decoded)
+				cur = per_element_deserialize(cur, last, r);
+		}
+	});
+	const double t_read = time_ms([&] {
+		for (int i = 0; i < rounds; i++) {
+			const char* cur = bytes.data();
+			for (auto& r : decoded)
+				cur = tuple_deserialize(cur, last, r);
+		}
+	});
+	if (decoded != records)
+		cerr << "round trip mismatch" << endl;
+
+	cout << N << " fields (" << records.size() * rounds << " records, " << sizeof(record) << " -> "
+		<< details::serialize_plan_of<serialize_format::raw, record>::raw_size << " bytes)" << endl
+		<< "  serialize, write per element     : " << t_element << " ms" << endl
+		<< "  tuple_serialize to output_sink   : " << t_sink << " ms" << endl
+		<< "  tuple_serialize to vector<char>  : " << t_buffer << " ms" << endl
+		<< "  deserialize, check per element   : " << t_element_read << " ms" << endl
+		<< "  tuple_deserialize                : " << t_read << " ms" << endl;
+}
+
+int main() {
+	bench<4>();
+	bench<8>();
+	bench<16>();
+	bench<32>();
+	bench<64>();
+}
@@ -0,0 +1,100 @@
+#include <USTL/tuple_hash.h>
+
+#include "../do_not_optimize.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace Ubpa::USTL;
+using namespace std;
+
+template<typename Func>
+double time_ms(Func&& f) {
+	auto begin = chrono::steady_clock::now();
+	f();
+	auto end = chrono::steady_clock::now();
+	return chrono::duration<double, milli>(end - begin).count();
+}
+
+// the field-by-field combine tuple_hash replaces
+struct combine_hash {
+	template<typename Tuple>
+	size_t operator()(const Tuple& t) const {
+		return tuple_accumulate(t, size_t{ 0 }, [](size_t seed, const auto& e) {
+			using T = decay_t<decltype(e)>;
+			return seed ^ (hash<T>{}(e) + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+		});
+	}
+};
+
+template<size_t... Is>
+auto make_key(index_sequence<Is...>) -> tuple<conditional_t<Is % 2 == 0, uint32_t, uint16_t>...>;
+
+template<typename Key, typename Hash>
+double bench_hash(const vector<Key>& queries, size_t& total) {
+	return time_ms([&] {
+		for (const auto& q : queries)
+			total += Hash{}(q);
+	});
+}
+
+template<typename Key, typename Hash>
+double bench_lookup(const vector<Key>& keys, const vector<Key>& queries, size_t& found) {
+	unordered_map<Key, size_t, Hash, tuple_equal> map;
+	map.reserve(keys.size());
+	for (size_t i = 0; i < keys.size(); i++)
+		map.emplace(keys[i], i);
+	return time_ms([&] {
+		for (const auto& q : queries)
+			found += map.count(q);
+	});
+}
+
+template<size_t N>
+void bench() {
+	using key = decltype(make_key(make_index_sequence<N>{}));
+
+	// id-like keys, random values in every field
+	// a cache-resident map, so the lookup cost is mostly hashing and probing
+	mt19937 rng{ 0 };
+	vector<key> keys(1 << 12);
+	for (auto& k : keys)
+		tuple_for_each(k, [&](auto& e) { e = static_cast<remove_reference_t<decltype(e)>>(rng()); });
+	vector<key> queries(1 << 22);
+	for (auto& q : queries)
+		q = keys[rng() % keys.size()];
+
+	size_t total = 0;
+	const double t_combine_hash = bench_hash<key, combine_hash>(queries, total);
+	const double t_tuple_hash = bench_hash<key, tuple_hash>(queries, total);
+	do_not_optimize(total);
+
+	size_t found = 0;
+	const double t_combine = bench_lookup<key, combine_hash>(keys, queries, found);
+	const double t_tuple = bench_lookup<key, tuple_hash>(keys, queries, found);
+	if (found != 2 * queries.size())
+		cerr << "lookup mismatch" << endl;
+
+	cout << N << " fields (" << queries.size() << " keys)" << endl
+		<< "  hash only" << endl
+		<< "    hash_combine over tuple_accumulate: " << t_combine_hash << " ms" << endl
+		<< "    tuple_hash                        : " << t_tuple_hash << " ms" << endl
+		<< "  std::unordered_map lookup" << endl
+		<< "    hash_combine over tuple_accumulate: " << t_combine << " ms" << endl
+		<< "    tuple_hash                        : " << t_tuple << " ms" << endl;
+}
+
+int main() {
+	bench<2>();
+	bench<4>();
+	bench<6>();
+	bench<8>();
+}
@@ -0,0 +1,80 @@
+#include <USTL/tuple.h>
+
+#include "../do_not_optimize.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace Ubpa::USTL;
+using namespace std;
+
+template<typename Func>
+double time_ms(Func&& f) {
+	auto begin = chrono::steady_clock::now();
+	f();
+	auto end = chrono::steady_clock::now();
+	return chrono::duration<double, milli>(end - begin).count();
+}
+
+template<size_t N>
+struct component {
+	size_t value;
+};
+
+template<size_t... Ns>
+auto make_components(index_sequence<Ns...>) -> tuple<component<Ns>...>;
+
+// the branch per element tuple_for_each_mask replaces
+template<typename Tuple, typename Func, size_t... Ns>
+void branch_for_each(Tuple& t, uint64_t mask, Func&& f, index_sequence<Ns...>) {
+	((mask >> Ns & 1 ? f(get<Ns>(t)) : void()), ...);
+}
+
+template<size_t Bits>
+void bench() {
+	constexpr size_t N = 64;
+	decltype(make_components(make_index_sequence<N>{})) t;
+	size_t value = 0;
+	tuple_for_each(t, [&](auto& c) { c.value = value++; });
+
+	// random archetype signatures with Bits set bits
+	mt19937_64 rng{ 0 };
+	vector<uint64_t> masks(1 << 18);
+	for (auto& m : masks) {
+		m = 0;
+		while (details::popcount(m) < Bits)
+			m |= uint64_t{ 1 } << (rng() % N);
+	}
+
+	// systems write their components, so the baseline's tests stay real branches
+	auto f = [](auto& c) { c.value = c.value * 3 + 1; };
+	const double t_branch = time_ms([&] {
+		for (auto m : masks)
+			branch_for_each(t, m, f, make_index_sequence<N>{});
+	});
+	const double t_mask = time_ms([&] {
+		for (auto m : masks)
+			tuple_for_each_mask(t, m, f);
+	});
+	size_t total = 0;
+	tuple_for_each(t, [&](const auto& c) { total += c.value; });
+	do_not_optimize(total);
+
+	cout << Bits << " of " << N << " bits set (" << masks.size() << " masks)" << endl
+		<< "  branch per element : " << t_branch << " ms" << endl
+		<< "  tuple_for_each_mask: " << t_mask << " ms" << endl;
+}
+
+int main() {
+	bench<1>();
+	bench<4>();
+	bench<8>();
+	bench<16>();
+	bench<48>();
+	bench<64>();
+}
@@ -0,0 +1,76 @@
+#include <USTL/small_vector.h>
+
+#include "../do_not_optimize.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace Ubpa::USTL;
+using namespace std;
+
+template<typename Func>
+double time_ms(Func&& f) {
+	auto begin = chrono::steady_clock::now();
+	f();
+	auto end = chrono::steady_clock::now();
+	return chrono::duration<double, milli>(end - begin).count();
+}
+
+// many short lists: build, read back, destroy
+template<typename List>
+double bench_lists(const vector<uint8_t>& lengths, size_t& total) {
+	return time_ms([&] {
+		vector<List> lists(lengths.size());
+		for (size_t i = 0; i < lengths.size(); i++) {
+			for (uint32_t k = 0; k < lengths[i]; k++)
+				lists[i].push_back(k);
+		}
+		for (const auto& list : lists) {
+			for (auto e : list)
+				total += e;
+		}
+	});
+}
+
+// one list grown far past the inline capacity, relocations are memcpy
+template<typename List>
+double bench_growth(size_t n, size_t& total) {
+	return time_ms([&] {
+		for (int round = 0; round < 64; round++) {
+			List list;
+			for (uint32_t k = 0; k < n; k++)
+				list.push_back(k);
+			total += list.back();
+		}
+	});
+}
+
+int main() {
+	mt19937 rng{ 0 };
+	for (uint8_t max_length : { uint8_t{ 4 }, uint8_t{ 8 }, uint8_t{ 16 } }) {
+		vector<uint8_t> lengths(1 << 20);
+		for (auto& n : lengths)
+			n = static_cast<uint8_t>(rng() % (max_length + 1));
+
+		size_t total = 0;
+		const double t_std = bench_lists<vector<uint32_t>>(lengths, total);
+		const double t_small = bench_lists<small_vector<uint32_t, 8>>(lengths, total);
+		do_not_optimize(total);
+
+		cout << lengths.size() << " lists of 0.." << int{ max_length } << " elements" << endl
+			<< "  std::vector           : " << t_std << " ms" << endl
+			<< "  small_vector<T, 8>    : " << t_small << " ms" << endl;
+	}
+
+	size_t total = 0;
+	const double t_std = bench_growth<vector<uint32_t>>(1 << 18, total);
+	const double t_small = bench_growth<small_vector<uint32_t, 8>>(1 << 18, total);
+	do_not_optimize(total);
+	cout << "64 lists grown to " << (1 << 18) << " elements" << endl
+		<< "  std::vector           : " << t_std << " ms" << endl
+		<< "  small_vector<T, 8>    : " << t_small << " ms" << endl;
+}
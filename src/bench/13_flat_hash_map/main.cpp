@@ -0,0 +1,92 @@
+#include <USTL/flat_hash_map.h>
+#include <USTL/memory.h>
+
+#include "../do_not_optimize.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using namespace Ubpa::USTL;
+using namespace std;
+
+template<typename Func>
+double time_ms(Func&& f) {
+	auto begin = chrono::steady_clock::now();
+	f();
+	auto end = chrono::steady_clock::now();
+	return chrono::duration<double, milli>(end - begin).count();
+}
+
+struct Times {
+	double insert;
+	double hit;
+	double miss;
+	double erase;
+};
+
+// insert every key, look up the present keys in random order, then absent ones, then erase half
+template<typename Map, typename Key>
+Times bench(vector<Key>& keys, vector<Key>& absent, const vector<size_t>& order, size_t& total) {
+	Times t{};
+	Map m;
+	t.insert = time_ms([&] {
+		for (size_t i = 0; i < keys.size(); i++)
+			m.emplace(keys[i], i);
+	});
+	t.hit = time_ms([&] {
+		for (int round = 0; round < 8; round++) {
+			for (size_t i : order)
+				total += m.find(keys[i])->second;
+		}
+	});
+	t.miss = time_ms([&] {
+		for (int round = 0; round < 8; round++) {
+			for (const auto& key : absent)
+				total += m.count(key);
+		}
+	});
+	t.erase = time_ms([&] {
+		for (size_t i = 0; i < keys.size(); i += 2)
+			total += m.erase(keys[i]);
+	});
+	total += m.size();
+	return t;
+}
+
+void print(const char* name, const Times& t) {
+	cout << "  " << name
+		<< " insert " << t.insert << " ms, hit " << t.hit << " ms, miss " << t.miss << " ms, erase " << t.erase << " ms" << endl;
+}
+
+int main() {
+	mt19937 rng{ 0 };
+	for (size_t n : { size_t{ 1 } << 10, size_t{ 1 } << 16, size_t{ 1 } << 20 }) {
+		vector<shared_object<int>> keys, absent;
+		for (size_t i = 0; i < n; i++) {
+			keys.push_back(make_shared_object<int>(static_cast<int>(i)));
+			absent.push_back(make_shared_object<int>(-static_cast<int>(i)));
+		}
+		vector<size_t> order(n);
+		for (size_t i = 0; i < n; i++)
+			order[i] = i;
+		shuffle(order.begin(), order.end(), rng);
+		// 8 lookup rounds over at least 1M keys
+		vector<size_t> lookups;
+		while (lookups.size() < (size_t{ 1 } << 20))
+			lookups.insert(lookups.end(), order.begin(), order.end());
+
+		size_t total = 0;
+		const Times t_std = bench<unordered_map<shared_object<int>, size_t>>(keys, absent, lookups, total);
+		const Times t_flat = bench<flat_hash_map<shared_object<int>, size_t>>(keys, absent, lookups, total);
+		do_not_optimize(total);
+
+		cout << n << " shared_object<int> keys, " << 8 * lookups.size() << " hits, " << 8 * n << " misses" << endl;
+		print("std::unordered_map:", t_std);
+		print("flat_hash_map     :", t_flat);
+	}
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+// the compiler must assume value is read, so the work producing it is kept
+template<typename T>
+inline void do_not_optimize(const T& value) {
+#if defined(_MSC_VER) && !defined(__clang__)
+	static const volatile void* sink;
+	sink = &value;
+	_ReadWriteBarrier();
+#else
+	asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
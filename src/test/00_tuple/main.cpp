@@ -1,6 +1,17 @@
 #include <USTL/tuple.h>
 
+#include <array>
+#include <cstdint>
+#include <cstdlib>
 #include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+
+template<std::size_t... Ns>
+constexpr auto make_index_tuple(std::index_sequence<Ns...>) {
+	return std::tuple{ std::integral_constant<std::size_t, Ns>{}... };
+}
 
 int main() {
 	constexpr auto acc = Ubpa::USTL::tuple_accumulate<true, false, true>(
@@ -60,4 +71,107 @@ int main() {
 	constexpr auto prependedTuple = Ubpa::USTL::tuple_prepend(std::tuple{ 1,2,3 }, -1, 0);
 	static_assert(std::get<0>(prependedTuple) == -1);
 	static_assert(std::get<1>(prependedTuple) == 0);
+
+	// the accumulator may change type at each step
+	constexpr auto grown = Ubpa::USTL::tuple_accumulate<false>(
+		std::tuple{ 1, 2.5, 'c' },
+		std::tuple{},
+		[](auto&& acc, auto e) {
+			return Ubpa::USTL::tuple_append(acc, e);
+		}
+	);
+	static_assert(std::is_same_v<decltype(grown), const std::tuple<double, char>>);
+
+	// move-only accumulator and elements, moved out of an rvalue tuple
+	auto owned = Ubpa::USTL::tuple_accumulate(
+		std::tuple{ std::make_unique<int>(1), std::make_unique<int>(2) },
+		std::make_unique<int>(0),
+		[](std::unique_ptr<int>&& acc, std::unique_ptr<int>&& e) {
+			*acc += *e;
+			return std::move(acc);
+		}
+	);
+	if (*owned != 3)
+		return 1;
+
+	// no recursion, large tuples are fine
+	constexpr auto big = make_index_tuple(std::make_index_sequence<300>{});
+	constexpr auto sum = Ubpa::USTL::tuple_accumulate(big, std::size_t{ 0 }, [](auto acc, auto e) { return acc + e; });
+	static_assert(sum == 299 * 300 / 2);
+	static_assert(Ubpa::USTL::tuple_count_if(big, [](auto e) { return e % 3 == 0; }) == 100);
+	static_assert(Ubpa::USTL::tuple_find_if(big, [](auto e) { return e == 123; }) == 123);
+
+	std::string visited;
+	Ubpa::USTL::tuple_for_each<false, true>(std::tuple{ "a", "b", "c" }, [&](const char* s) { visited += s; });
+	if (visited != "bc")
+		return 1;
+
+	// runtime index -> element
+	constexpr auto visited_size = Ubpa::USTL::tuple_visit_at(std::tuple{ 1, 2.5, 'c' }, 1, [](auto e) { return sizeof(e); });
+	static_assert(visited_size == sizeof(double));
+
+	std::tuple<int, std::string, double> mixed{ 1, "str", 3. };
+	const std::size_t str_idx = Ubpa::USTL::tuple_find_if(mixed, [](const auto& e) {
+		return std::is_same_v<std::decay_t<decltype(e)>, std::string>;
+	});
+	Ubpa::USTL::tuple_visit_at(mixed, str_idx, [](auto& e) { // mutable
+		if constexpr (std::is_same_v<std::decay_t<decltype(e)>, std::string>)
+			e += "ing";
+	});
+	const auto& cmixed = mixed;
+	const bool is_const = Ubpa::USTL::tuple_visit_at(cmixed, 0, [](auto& e) { // const
+		return std::is_const_v<std::remove_reference_t<decltype(e)>>;
+	});
+	const std::string moved = Ubpa::USTL::tuple_visit_at(std::move(mixed), str_idx, [](auto&& e) -> std::string { // rvalue
+		if constexpr (std::is_same_v<decltype(e), std::string&&>)
+			return std::move(e);
+		else
+			return {};
+	});
+	if (!is_const || moved != "string")
+		return 1;
+
+	// runtime masks, only the set bits are visited
+	std::tuple<int, std::string, double, char> row{ 1, "two", 3.0, '4' };
+	std::string masked;
+	Ubpa::USTL::tuple_for_each_mask(row, 0b1010, [&](const auto& e) {
+		if constexpr (std::is_same_v<std::decay_t<decltype(e)>, std::string>)
+			masked += e;
+		else
+			masked += static_cast<char>(e);
+	});
+	if (masked != "two4")
+		return 1;
+	Ubpa::USTL::tuple_for_each_mask(row, ~std::uint64_t{ 0 } << 4, [](auto&) { std::abort(); }); // bits past the size
+	Ubpa::USTL::tuple_for_each_mask(std::tuple<>{}, ~std::uint64_t{ 0 }, [](auto&) { std::abort(); });
+
+	auto counters = make_index_tuple(std::make_index_sequence<64>{});
+	const auto masked_sum = Ubpa::USTL::tuple_accumulate_mask(counters, (std::uint64_t{ 1 } << 63) | 0b101, std::size_t{ 0 },
+		[](std::size_t acc, auto n) { return acc + n; });
+	if (masked_sum != 63 + 2 + 0)
+		return 1;
+	const auto all_sum = Ubpa::USTL::tuple_accumulate_mask(counters, ~std::uint64_t{ 0 }, std::size_t{ 0 },
+		[](std::size_t acc, auto n) { return acc + n; });
+	if (all_sum != 63 * 64 / 2)
+		return 1;
+
+	// type membership at compile time
+	using Types = std::tuple<int, float, int, const int, std::string>;
+	static_assert(Ubpa::USTL::tuple_index_of_type<int, Types> == 0);
+	static_assert(Ubpa::USTL::tuple_index_of_type<std::string, const Types&> == 4);
+	static_assert(Ubpa::USTL::tuple_index_of_type<double, Types> == static_cast<std::size_t>(-1));
+	static_assert(Ubpa::USTL::tuple_count_type<int, Types> == 2);
+	static_assert(Ubpa::USTL::tuple_count_type<const int, Types> == 1);
+	static_assert(Ubpa::USTL::tuple_count_type<int, std::tuple<>> == 0);
+	static_assert(std::is_same_v<Ubpa::USTL::tuple_indices_of_type<int, Types>, std::index_sequence<0, 2>>);
+	static_assert(Ubpa::USTL::tuple_count_type<int, std::array<int, 3>> == 3);
+	static_assert(Ubpa::USTL::tuple_count_type<int, std::pair<int, float>> == 1);
+
+	// tuple_find / tuple_count only compare elements of the same (decayed) type
+	constexpr std::tuple<int, float, int, const int> values{ 1, 2.f, 3, 3 };
+	static_assert(Ubpa::USTL::tuple_find(values, 3) == 2);
+	static_assert(Ubpa::USTL::tuple_find(values, 2) == static_cast<std::size_t>(-1));
+	static_assert(Ubpa::USTL::tuple_find(values, 2.f) == 1);
+	static_assert(Ubpa::USTL::tuple_count(values, 3) == 2);
+	static_assert(Ubpa::USTL::tuple_count(big, std::integral_constant<std::size_t, 7>{}) == 1);
 }
@@ -1,10 +1,15 @@
 #include <USTL/cstring.h>
+#include <USTL/tuple.h>
 
 #include <iostream>
+#include <unordered_map>
 
 using namespace Ubpa::USTL;
 using namespace std;
 
+static constexpr cstring dotted_key{ "a.bc.def" };
+static constexpr std::string_view abs_path{ "/usr//local/bin/" };
+
 int main() {
 	constexpr cstring a{ "123" };
 	constexpr cstring b{ '4' };
@@ -16,4 +21,76 @@ int main() {
 	cout << cstring_integer<255, 10> << endl;
 	cout << cstring_integer<255, 16> << endl;
 	cout << cstring{ cstring{"__arg_"}, cstring_integer<1> } << endl;
+
+	{ // search and slicing
+		constexpr cstring path{ "user.login.event" };
+		static_assert(path.find('.') == 4);
+		static_assert(path.find("event") == 11);
+		static_assert(path.rfind('.') == 10);
+		static_assert(path.rfind("e") == 13);
+		static_assert(path.starts_with("user."));
+		static_assert(path.ends_with(".event"));
+		static_assert(path.ends_with('t'));
+		static_assert(path.contains("login"));
+		static_assert(!path.contains("logout"));
+		static_assert(path.back() == 't');
+		static_assert(path.substr<5, 5>() == "login");
+		static_assert(std::is_same_v<decltype(path.substr<11>()), cstring<5>>);
+		static_assert(path.substr(5, 5) == "login");
+
+		constexpr cstring haystack{ "abcdefghijklmnopqrstuvwxyz0123456789abcdefghijklmnopqrstuvwxyz_needle_0123456789" };
+		assert(haystack.find("needle") == 63);
+		assert(haystack.find('_', 63) == 69);
+		assert(haystack.rfind('a') == 36);
+		assert(haystack.rfind('!') == decltype(haystack)::npos);
+		assert(haystack.contains("z_n"));
+	}
+
+	{ // split
+		constexpr auto keys = cstring_split<dotted_key, '.'>;
+		static_assert(std::tuple_size_v<decltype(keys)> == 3);
+		static_assert(std::get<0>(keys) == "a");
+		static_assert(std::get<2>(keys) == "def");
+		static_assert(tuple_find(keys, cstring{ "bc" }) == 1);
+		static_assert(tuple_find(keys, cstring{ "de" }) == static_cast<size_t>(-1));
+
+		constexpr auto dirs = cstring_split<abs_path, '/'>;
+		static_assert(std::is_same_v<decltype(dirs), const std::tuple<cstring<3>, cstring<5>, cstring<3>>>);
+		tuple_for_each(dirs, [](const auto& dir) {
+			cout << dir << endl;
+		});
+	}
+
+	{ // inplace_string
+		constexpr auto s = [] {
+			inplace_string<16> s{ "hello" };
+			s += ' ';
+			s += cstring{ "world" };
+			return s;
+		}();
+		static_assert(s.size() == 11);
+		static_assert(s == "hello world");
+		static_assert(s.find('w') == 6);
+		static_assert(s.find("world") == 6);
+		static_assert(s.find("xyz") == inplace_string<16>::npos);
+		static_assert(s > cstring{ "hello" });
+		static_assert(sizeof(inplace_string<15>) == 17);
+
+		inplace_string<64> key{ "0123456789abcdefghijklmnopqrstuvwxyz" };
+		assert(key.find('z') == 35);
+		assert(key.find("xyz") == 33);
+		assert(key.find("xyz", 34) == inplace_string<64>::npos);
+		assert(key == "0123456789abcdefghijklmnopqrstuvwxyz");
+		assert(key != a);
+		assert(key.compare("0123456789abcdefghijklmnopqrstuvwxyZ") > 0);
+		key.erase(10);
+		assert(key == "0123456789");
+		key.pop_back();
+		key.push_back('!');
+		cout << key << endl;
+
+		std::unordered_map<inplace_string<32>, int> m;
+		m[inplace_string<32>{ "key" }] = 1;
+		assert(m.at("key") == 1);
+	}
 }
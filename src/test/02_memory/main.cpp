@@ -30,6 +30,10 @@ int main() {
 		std::unordered_map<shared_object<int>, size_t> m1; // hash
 		std::map<shared_object<int>, size_t> m2; // <
 		std::map<shared_object<int>, size_t, std::owner_less<shared_object<int>>> m3; // owner_before
+		auto key = make_shared_object<int>(1);
+		m1.emplace(key, 1); // const key_type& does not copy
+		m2.emplace(key, 2);
+		cout << m1.at(key) << m2.at(key) << endl;
 	}
 	{ // unique
 		unique_object<int[]> uo0;
@@ -40,5 +44,9 @@ int main() {
 		unique_object<A[]> uo4{ new A[5] };
 		std::unordered_map<unique_object<int>, size_t> m1; // hash
 		std::map<unique_object<int>, size_t> m2; // <
+		auto key = make_unique_object<int>(2);
+		const int* raw = key.get();
+		m1.emplace(std::move(key), 3);
+		cout << (*m1.begin()->first == 2 && m1.begin()->first.get() == raw) << endl;
 	}
 }
@@ -0,0 +1,127 @@
+#include <USTL/charconv.h>
+
+#include <iostream>
+#include <cassert>
+#include <charconv>
+#include <cctype>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+
+using namespace Ubpa::USTL;
+using namespace std;
+
+template<auto Num, size_t Base>
+void check_same_as_cstring_integer() {
+	char buffer[integer_max_length<decltype(Num), Base>];
+	const char* last = write_integer<Base>(buffer, Num);
+	constexpr auto expected = cstring_integer<Num, Base>;
+	assert(string_view(buffer, last - buffer) == expected);
+	assert(write_integer(buffer, Num, Base) == last);
+	assert((integer_string<decltype(Num), Base>{ Num } == expected));
+}
+
+template<typename T, size_t Base>
+void check_random(mt19937_64& rng) {
+	for (size_t i = 0; i < 10000; i++) {
+		const T value = static_cast<T>(rng() >> (rng() % 64));
+		char buffer[integer_max_length<T, Base>];
+		const char* last = write_integer<Base>(buffer, value);
+
+		char expected[128];
+		auto [ptr, ec] = to_chars(expected, expected + sizeof(expected), value, Base);
+		assert(ec == errc{});
+		for (char* p = expected; p != ptr; ++p)
+			*p = static_cast<char>(toupper(*p));
+		assert(string_view(buffer, last - buffer) == string_view(expected, ptr - expected));
+	}
+}
+
+template<typename T>
+void check_parse_random(mt19937_64& rng) {
+	for (size_t i = 0; i < 100000; i++) {
+		string str;
+		if (rng() % 4 == 0)
+			str = to_string(static_cast<T>(rng() >> (rng() % 64)));
+		else {
+			const size_t n = rng() % 24;
+			for (size_t k = 0; k < n; k++)
+				str += "0123456789-+x"[rng() % (k == 0 ? 13 : 11)];
+		}
+		const auto result = parse_integer<T>(str, 10);
+		T expected{};
+		const char* first = str.data() + (!str.empty() && str[0] == '+' && (str.size() < 2 || str[1] != '-'));
+		auto [ptr, ec] = from_chars(first, str.data() + str.size(), expected);
+		assert(result.ec == ec);
+		if (ec != errc::invalid_argument)
+			assert(result.size == static_cast<size_t>(ptr - str.data()));
+		if (ec == errc{})
+			assert(result.value == expected);
+	}
+}
+
+static constexpr cstring hex_literal{ "0x7FFFFFFF" };
+static constexpr cstring negative_literal{ "-0b1010" };
+static constexpr std::string_view octal_literal{ "0777" };
+
+int main() {
+	static_assert(integer_max_length<uint8_t, 10> == 3);
+	static_assert(integer_max_length<int32_t, 10> == 11);
+	static_assert(integer_max_length<uint64_t, 2> == 64);
+	static_assert(integer_max_length<int64_t, 16> == 17);
+
+	constexpr integer_string<int, 16> hex{ -255 };
+	static_assert(hex == "-FF");
+	static_assert(hex == cstring_integer<-255, 16>);
+
+	check_same_as_cstring_integer<0, 10>();
+	check_same_as_cstring_integer<255, 2>();
+	check_same_as_cstring_integer<255, 8>();
+	check_same_as_cstring_integer<255, 10>();
+	check_same_as_cstring_integer<255, 16>();
+	check_same_as_cstring_integer<-1234567, 10>();
+	check_same_as_cstring_integer<1234567u, 7>();
+	check_same_as_cstring_integer<-1234567, 13>();
+	check_same_as_cstring_integer<std::numeric_limits<uint64_t>::max(), 10>();
+	check_same_as_cstring_integer<std::numeric_limits<int64_t>::max(), 16>();
+
+	mt19937_64 rng{ 0 };
+	check_random<int32_t, 10>(rng);
+	check_random<uint64_t, 10>(rng);
+	check_random<int64_t, 16>(rng);
+	check_random<uint16_t, 2>(rng);
+	check_random<int8_t, 3>(rng);
+	check_random<uint32_t, 12>(rng);
+
+	char buffer[integer_max_length<int64_t, 10>];
+	const char* last = write_integer(buffer, numeric_limits<int64_t>::min(), 10);
+	assert(string_view(buffer, last - buffer) == "-9223372036854775808");
+
+	static_assert(cstring_to_integer<hex_literal> == 0x7FFFFFFF);
+	static_assert(cstring_to_integer<negative_literal> == -10);
+	static_assert(cstring_to_integer<octal_literal, unsigned> == 0777u);
+	static_assert(parse_integer("12345").value == 12345);
+	static_assert(parse_integer("-0").value == 0);
+	static_assert(parse_integer("0x").value == 0 && parse_integer("0x").size == 1);
+	static_assert(parse_integer("ff", 16).value == 255);
+	static_assert(parse_integer<int8_t>("-128").value == -128);
+	static_assert(parse_integer<int8_t>("128").ec == errc::result_out_of_range);
+	static_assert(parse_integer<unsigned>("-1").ec == errc::invalid_argument);
+	static_assert(!parse_integer(""));
+
+	assert(parse_integer<uint64_t>("18446744073709551615").value == numeric_limits<uint64_t>::max());
+	assert(parse_integer<uint64_t>("18446744073709551616").ec == errc::result_out_of_range);
+	assert(parse_integer<int64_t>("-9223372036854775808").value == numeric_limits<int64_t>::min());
+	assert(parse_integer<int32_t>("1234567812345678").ec == errc::result_out_of_range);
+	assert(parse_integer<int64_t>("1234567812345678,").size == 16);
+	assert(parse_integer<int64_t>("12345678123456789").value == 12345678123456789);
+	check_parse_random<int8_t>(rng);
+	check_parse_random<int32_t>(rng);
+	check_parse_random<uint32_t>(rng);
+	check_parse_random<int64_t>(rng);
+	check_parse_random<uint64_t>(rng);
+
+	cout << integer_string<int>{ -42 } << endl;
+	cout << integer_string<unsigned, 16>{ 0xBEEFu } << endl;
+}
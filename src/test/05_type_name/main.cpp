@@ -0,0 +1,42 @@
+#include <USTL/type_name.h>
+
+#include <iostream>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace Ubpa::USTL;
+using namespace std;
+
+struct A {};
+namespace N { template<typename T> class B {}; }
+enum class E { X };
+namespace { struct Anonymous {}; }
+
+int main() {
+	static_assert(type_name<int> == "int");
+	static_assert(type_name<A> == "A");
+	static_assert(type_name<E> == "E");
+	static_assert(type_name<N::B<A>> == "N::B<A>");
+	static_assert(type_name<const char*> == "const char*");
+	static_assert(type_name<int&> == "int&");
+	static_assert(type_name<unsigned long> == "unsigned long");
+	static_assert(type_name<long long> == "long long");
+	static_assert(type_name<std::tuple<int, float>> == "std::tuple<int,float>");
+	static_assert(type_name<N::B<N::B<int>>> == "N::B<N::B<int>>");
+	static_assert(type_name<std::string>.starts_with("std::basic_string<char"));
+	static_assert(type_name<Anonymous> == "(anonymous namespace)::Anonymous");
+
+	static_assert(type_id<int> == string_hash("int"));
+	static_assert(type_id<int> != type_id<unsigned>);
+	static_assert(type_id<A> != type_id<N::B<A>>);
+
+	std::map<std::uint64_t, std::string_view> registry;
+	registry.emplace(type_id<A>, type_name<A>);
+	registry.emplace(type_id<N::B<A>>, type_name<N::B<A>>);
+
+	for (const auto& [id, name] : registry)
+		cout << id << " : " << name << endl;
+	cout << type_name<std::map<std::string, std::vector<int>>> << endl;
+}
@@ -0,0 +1,62 @@
+#include <USTL/enum.h>
+
+#include <iostream>
+#include <cassert>
+
+using namespace Ubpa::USTL;
+using namespace std;
+
+enum class Color { Red, Green = 4, Blue = -3 };
+enum Unscoped : unsigned char { Alpha = 1, Beta = 2, Gamma = 200 };
+namespace N { enum class Level { Debug, Info, Warn, Error }; }
+
+enum class Big { Low = 0, High = 1000 };
+template<>
+struct Ubpa::USTL::enum_range<Big> {
+	static constexpr long long min = 0;
+	static constexpr long long max = 1000;
+};
+
+// no fixed underlying type, only [0, 1] are values of Plain
+enum Plain { A, B };
+template<>
+struct Ubpa::USTL::enum_range<Plain> {
+	static constexpr long long min = 0;
+	static constexpr long long max = 1;
+};
+
+int main() {
+	static_assert(enum_name<Color::Red> == "Red");
+	static_assert(enum_name<Color::Blue> == "Blue");
+	static_assert(enum_name<Beta> == "Beta");
+	static_assert(enum_name<N::Level::Warn> == "Warn");
+
+	static_assert(enum_count<Color> == 3);
+	static_assert(enum_values<Color>[0] == Color::Blue);
+	static_assert(enum_names<Color>[0] == "Blue");
+	static_assert(enum_names<Color>[2] == "Green");
+	static_assert(enum_count<Unscoped> == 3);
+	static_assert(enum_count<Big> == 2);
+
+	static_assert(enum_name_of(Color::Green) == "Green");
+	static_assert(enum_name_of(static_cast<Color>(1)).empty());
+	static_assert(enum_name_of(Gamma) == "Gamma");
+	static_assert(enum_name_of(Big::High) == "High");
+
+	static_assert(enum_cast<Color>("Green") == Color::Green);
+	static_assert(!enum_cast<Color>("green"));
+	static_assert(enum_cast<Unscoped>("Gamma") == Gamma);
+	static_assert(enum_cast<Big>("High") == Big::High);
+
+	static_assert(enum_name<B> == "B");
+	static_assert(enum_count<Plain> == 2 && enum_values<Plain>[1] == B);
+	static_assert(enum_name_of(A) == "A");
+	static_assert(enum_cast<Plain>("B") == B && !enum_cast<Plain>("C"));
+
+	for (auto name : enum_names<N::Level>) {
+		auto level = enum_cast<N::Level>(name);
+		assert(level && enum_name_of(*level) == name);
+		cout << name << " = " << static_cast<int>(*level) << endl;
+	}
+	assert(!enum_cast<N::Level>("Fatal"));
+}
@@ -0,0 +1,48 @@
+#include <USTL/pattern.h>
+
+#include <iostream>
+#include <cassert>
+
+using namespace Ubpa::USTL;
+using namespace std;
+
+static constexpr cstring user_event{ "user.*.event" };
+static constexpr cstring file_glob{ "[!.]*.[ch]pp" };
+static constexpr cstring question{ "a?c\\*" };
+static constexpr cstring metric_ok{ "cpu\\.\\d+\\.idle_?[a-z]*" };
+static constexpr cstring optional{ "colou?r.*" };
+
+int main() {
+	using user_pattern = static_glob<user_event>;
+	static_assert(user_pattern::match("user.login.event"));
+	static_assert(user_pattern::match("user..event"));
+	static_assert(user_pattern::match("user.a.b.event"));
+	static_assert(!user_pattern::match("user.login.events"));
+	static_assert(!user_pattern::match("users.login.event"));
+	static_assert(!user_pattern::match(""));
+
+	static_assert(static_glob<file_glob>::match("main.cpp"));
+	static_assert(static_glob<file_glob>::match("a.hpp"));
+	static_assert(!static_glob<file_glob>::match(".hidden.cpp"));
+	static_assert(!static_glob<file_glob>::match("main.c"));
+
+	static_assert(static_glob<question>::match("abc*"));
+	static_assert(!static_glob<question>::match("abcd"));
+
+	static_assert(static_regex<metric_ok>::match("cpu.12.idle"));
+	static_assert(static_regex<metric_ok>::match("cpu.0.idle_total"));
+	static_assert(static_regex<metric_ok>::match("cpu.0.idletotal"));
+	static_assert(!static_regex<metric_ok>::match("cpu..idle"));
+	static_assert(!static_regex<metric_ok>::match("cpu.1.idle_Total"));
+
+	static_assert(static_regex<optional>::match("color"));
+	static_assert(static_regex<optional>::match("colour-red"));
+	static_assert(!static_regex<optional>::match("colouur"));
+
+	constexpr static_glob<user_event> matcher;
+	const char* keys[] = { "user.login.event", "user.logout.event", "order.created.event" };
+	for (auto key : keys)
+		cout << key << " : " << matcher(key) << endl;
+	assert(matcher(keys[1]) && !matcher(keys[2]));
+	cout << "states of " << user_event << " : " << static_glob<user_event>::state_count << endl;
+}
@@ -0,0 +1,50 @@
+#include <USTL/utf8.h>
+
+#include <iostream>
+#include <cassert>
+#include <sstream>
+#include <string>
+
+using namespace Ubpa::USTL;
+using namespace std;
+
+int main() {
+	constexpr cstring name{ "gr\xC3\xBC\xC3\x9F" "e \xE2\x82\xAC \xF0\x9F\x98\x80" }; // "grüße € 😀"
+	static_assert(utf8_validate(name));
+	static_assert(utf8_length(name) == 9);
+	static_assert(utf8_validate(""));
+	static_assert(!utf8_validate("\xC0\xAF")); // overlong '/'
+	static_assert(!utf8_validate("\xED\xA0\x80")); // surrogate
+	static_assert(!utf8_validate("\xF4\x90\x80\x80")); // above U+10FFFF
+	static_assert(!utf8_validate("\xE2\x82")); // truncated
+	static_assert(!utf8_validate("\x80")); // lone continuation
+
+	constexpr cstring wide{ L"wide" };
+	static_assert(std::is_same_v<decltype(wide), const basic_cstring<wchar_t, 4>>);
+	static_assert(wide == L"wide");
+	static_assert(wide.find(L'd') == 2);
+	constexpr cstring u16{ u"utf16" };
+	static_assert(u16.substr<3>() == u"16");
+	static_assert(cstring{ u16, cstring{ u'!' } } == u"utf16!");
+
+	wostringstream wout;
+	wout << wide << cstring{ "!" }; // a char string is widened
+	assert(wout.str() == L"wide!");
+
+	// long runtime input: ASCII runs with scattered multi-byte sequences
+	string text;
+	for (size_t i = 0; i < 1000; i++) {
+		text += "plain ascii text, ";
+		if (i % 7 == 0)
+			text += name;
+	}
+	assert(utf8_validate(text));
+	assert(utf8_length(text) == 1000 * 18 + 143 * 9);
+	text[text.size() / 2] = '\xFF';
+	assert(!utf8_validate(text));
+	text[text.size() / 2] = ' ';
+	text += "\xF0\x9F\x98";
+	assert(!utf8_validate(text));
+
+	cout << name << " : " << utf8_length(name) << " code points" << endl;
+}
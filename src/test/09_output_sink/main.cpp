@@ -0,0 +1,99 @@
+#include <USTL/output_sink.h>
+
+#include <iostream>
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <sstream>
+#include <string>
+
+using namespace Ubpa::USTL;
+using namespace std;
+
+constexpr auto format_key(int id) {
+	inplace_string<32> key;
+	char buffer[32]{};
+	fixed_buffer_writer writer{ buffer };
+	writer << "key_" << id << '/' << cstring{ "end" };
+	key = writer.view();
+	return key;
+}
+
+int main() {
+	{ // fixed_buffer_writer
+		static_assert(format_key(-42) == "key_-42/end");
+
+		char buffer[8];
+		fixed_buffer_writer writer{ buffer };
+		writer << 1234 << "567";
+		assert(writer.view() == "1234567" && !writer.overflowed());
+		writer << 89;
+		assert(writer.view() == "12345678" && writer.overflowed());
+		writer.clear();
+		writer.write_integer<16>(255u);
+		assert(writer.view() == "FF" && writer.available() == 6);
+		writer.clear();
+		writer << static_cast<signed char>('a') << static_cast<unsigned char>('b') << static_cast<int>(static_cast<int8_t>(-1));
+		assert(writer.view() == "ab-1"); // as std::ostream, signed / unsigned char are characters
+	}
+
+	{ // output_sink to a callback
+		string out;
+		size_t flushes = 0;
+		auto append = [&](string_view chunk) {
+			out += chunk;
+			flushes++;
+		};
+		string expected;
+		{
+			output_sink<64> sink{ append };
+			for (int i = 0; i < 100; i++) {
+				sink << "line " << i << ':' << numeric_limits<int64_t>::min() << '\n';
+				expected += "line " + to_string(i) + ':' + to_string(numeric_limits<int64_t>::min()) + '\n';
+			}
+			const string big(200, 'x');
+			sink << big;
+			expected += big;
+			assert(sink.good());
+		}
+		assert(out == expected);
+		assert(flushes < expected.size() / 32);
+	}
+
+	{ // a failing callback is reported
+		auto fail = [](string_view) { return false; };
+		output_sink<64> sink{ fail };
+		sink << "dropped";
+		sink.flush();
+		assert(!sink.good());
+	}
+
+	{ // output_sink to FILE* and fd
+		FILE* file = tmpfile();
+		assert(file);
+		{
+			auto sink = output_sink<>::to_file(file);
+			sink << cstring{ "file " } << 1u << '\n';
+		}
+		fflush(file);
+		{
+			auto sink = output_sink<>::to_fd(fileno(file));
+			sink << integer_string<int>{ 2 } << '\n';
+		}
+		rewind(file);
+		char content[32]{};
+		const size_t n = fread(content, 1, sizeof(content), file);
+		fclose(file);
+		assert(string_view(content, n) == "file 1\n2\n");
+	}
+
+	{ // ostream writes the whole string
+		ostringstream os;
+		os << cstring{ "abc" } << inplace_string<8>{ "de" };
+		assert(os.str() == "abcde");
+	}
+
+	auto sink = output_sink<>::to_fd(1);
+	sink << cstring{ "output_sink: " } << 42 << '\n';
+}
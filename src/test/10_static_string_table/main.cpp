@@ -0,0 +1,50 @@
+#include <USTL/static_string_table.h>
+#include <USTL/type_name.h>
+
+#include <iostream>
+#include <cassert>
+
+using namespace Ubpa::USTL;
+using namespace std;
+
+struct Position {};
+struct Velocity {};
+
+constexpr cstring position{ "position" };
+constexpr cstring pos{ "pos" };
+constexpr cstring velocity{ "velocity" };
+constexpr string_view blank;
+constexpr cstring position_again{ "position" };
+
+int main() {
+	using table = static_string_table<pos, position, velocity, blank, position_again>;
+	static_assert(table::size() == 5);
+	static_assert(table::blob_size() == 16); // "position" + "velocity"
+	static_assert(table::data()[table::blob_size()] == '\0');
+	static_assert(sizeof(table::ref_type) == 8);
+
+	static_assert(table::ref<0>.view() == "pos");
+	static_assert(table::ref<1>.view() == "position");
+	static_assert(table::ref<2>.view() == "velocity");
+	static_assert(table::ref<3>.view().empty());
+	static_assert(table::ref<1> == table::ref<4>);
+	static_assert(table::ref<0> != table::ref<1>);
+	static_assert(table::ref<0>.offset == table::ref<1>.offset); // "pos" lives inside "position"
+	static_assert(table::view(2) == velocity);
+
+	static_assert(table::find("velocity") == table::ref<2>);
+	static_assert(!table::find("speed"));
+
+	using names = static_string_table<type_name<Position>, type_name<Velocity>, type_name<Position>>;
+	static_assert(names::ref<0> == names::ref<2>);
+	static_assert(names::blob_size() == type_name<Position>.size() + type_name<Velocity>.size());
+
+	using none = static_string_table<>;
+	static_assert(none::size() == 0 && none::blob_size() == 0);
+
+	const string_view v = table::refs[2];
+	assert(v == "velocity" && v.data() == table::data() + 8);
+
+	for (const auto& r : names::refs)
+		cout << string_view{ r } << endl;
+}
@@ -0,0 +1,76 @@
+#include <USTL/string_interner.h>
+
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Ubpa::USTL;
+using namespace std;
+
+int main() {
+	{ // ids match the compile-time hash
+		constexpr cstring tag{ "tag" };
+		constexpr auto tag_id = string_interner::id_of(tag);
+		static_assert(tag_id == string_hash(tag));
+
+		string_interner interner;
+		assert(!interner.find("tag"));
+		assert(!interner.find(tag_id));
+
+		const auto a = interner.intern(string{ "tag" });
+		assert(a.id == tag_id && a.str == "tag");
+		const auto b = interner.intern("tag");
+		assert(b.str.data() == a.str.data());
+		assert(interner.find(tag_id) == "tag");
+		assert(interner.find("tag")->str.data() == a.str.data());
+		assert(interner.intern("").str.empty());
+		assert(interner.size() == 2);
+	}
+
+	{ // views stay valid while the tables grow
+		string_interner interner;
+		vector<interned_string> interned;
+		for (size_t i = 0; i < 100000; i++)
+			interned.push_back(interner.intern("label_" + to_string(i)));
+		assert(interner.size() == 100000);
+		for (size_t i = 0; i < interned.size(); i++) {
+			assert(interned[i].str == "label_" + to_string(i));
+			assert(interner.intern(interned[i].str).str.data() == interned[i].str.data());
+		}
+		const string big(100000, 'x');
+		assert(interner.intern(big).str == big);
+	}
+
+	{ // concurrent interning of overlapping keys
+		string_interner interner;
+		constexpr size_t thread_num = 8;
+		constexpr size_t key_num = 20000;
+		vector<vector<interned_string>> results(thread_num);
+		vector<thread> threads;
+		for (size_t t = 0; t < thread_num; t++) {
+			threads.emplace_back([&, t] {
+				for (size_t i = 0; i < key_num; i++) {
+					const size_t k = (i * 7 + t * 1237) % key_num;
+					results[t].push_back(interner.intern("metric_" + to_string(k)));
+				}
+			});
+		}
+		for (auto& th : threads)
+			th.join();
+
+		assert(interner.size() == key_num);
+		for (size_t i = 0; i < key_num; i++) {
+			const auto key = "metric_" + to_string(i);
+			const auto e = interner.find(key);
+			assert(e && e->str == key && e->id == string_hash(key));
+		}
+		for (size_t t = 0; t < thread_num; t++) {
+			for (const auto& r : results[t])
+				assert(interner.find(r.str)->str.data() == r.str.data());
+		}
+	}
+
+	cout << "string_interner: ok" << endl;
+}
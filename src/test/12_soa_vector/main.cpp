@@ -0,0 +1,137 @@
+#include <USTL/soa_vector.h>
+
+#include <iostream>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+using namespace Ubpa::USTL;
+using namespace std;
+
+struct throw_on_copy {
+	static inline int live = 0;
+	int value;
+	explicit throw_on_copy(int v) : value{ v } { live++; }
+	throw_on_copy(const throw_on_copy& other) : value{ other.value } {
+		if (value < 0)
+			throw runtime_error{ "copy" };
+		live++;
+	}
+	~throw_on_copy() { live--; }
+};
+
+// copying throws, moving may throw, so growth copies it
+struct throw_on_copy_movable {
+	int value;
+	explicit throw_on_copy_movable(int v) : value{ v } {}
+	throw_on_copy_movable(const throw_on_copy_movable& other) : value{ other.value } {
+		if (value < 0)
+			throw runtime_error{ "copy" };
+	}
+	throw_on_copy_movable(throw_on_copy_movable&& other) : value{ other.value } {}
+};
+
+int main() {
+	{ // rows and columns
+		soa_vector<float, string, int> v;
+		assert(v.empty());
+		for (int i = 0; i < 100; i++)
+			v.emplace_back(static_cast<float>(i), to_string(i), i * 2);
+		v.push_back({ 100.f, "100", 200 });
+		const tuple<float, string, int> row{ 101.f, "101", 202 };
+		v.push_back(row);
+		assert(v.size() == 102 && v.capacity() >= 102);
+
+		auto [f, s, i] = v[42];
+		assert(f == 42.f && s == "42" && i == 84);
+		s += "!";
+		assert(get<1>(v[42]) == "42!");
+
+		auto ints = v.column<2>();
+		static_assert(is_same_v<decltype(ints), soa_column<int>>);
+		assert(accumulate(ints.begin(), ints.end(), 0) == 101 * 102);
+		for (auto& x : v.column<float>())
+			x *= 2;
+		assert(get<0>(v[101]) == 202.f);
+
+		// columns are aligned and do not overlap
+		assert(reinterpret_cast<uintptr_t>(v.column<0>().data()) % 64 == 0);
+		assert(reinterpret_cast<uintptr_t>(v.column<1>().data()) % 64 == 0);
+		assert(reinterpret_cast<uintptr_t>(v.column<2>().data()) % 64 == 0);
+		assert(static_cast<const void*>(v.column<0>().data() + v.capacity()) <= static_cast<const void*>(v.column<1>().data()));
+
+		// rows work with the tuple algorithms
+		size_t chars = 0;
+		tuple_for_each(v[7], [&](const auto& e) {
+			if constexpr (is_same_v<decay_t<decltype(e)>, string>)
+				chars += e.size();
+		});
+		assert(chars == 1);
+		assert(tuple_find(v[7], 14) == 2);
+
+		// the new row may alias an element that moves during growth
+		soa_vector<string> strs;
+		strs.emplace_back("alias");
+		while (strs.size() < strs.capacity())
+			strs.emplace_back("x");
+		strs.emplace_back(get<0>(strs[0]));
+		assert(get<0>(strs.back()) == "alias");
+
+		const auto copy = v;
+		assert(copy.size() == v.size() && get<1>(copy[5]) == "5");
+		assert(copy.column<1>().data() != v.column<1>().data());
+		auto moved = std::move(v);
+		assert(v.empty() && moved.size() == 102);
+		moved.pop_back();
+		assert(get<2>(moved.back()) == 200);
+		moved.clear();
+		assert(moved.empty());
+	}
+
+	{ // move-only columns
+		soa_vector<unique_ptr<int>, int> v;
+		for (int i = 0; i < 20; i++)
+			v.emplace_back(make_unique<int>(i), i);
+		assert(*get<0>(v[19]) == 19);
+	}
+
+	{ // a throwing copy during growth leaves the vector untouched
+		soa_vector<int, throw_on_copy> v;
+		v.emplace_back(0, -1); // constructed in place, copying it throws
+		while (v.size() < v.capacity())
+			v.emplace_back(0, 1);
+		const size_t size = v.size();
+		const auto* data = v.column<1>().data();
+		bool thrown = false;
+		try {
+			v.emplace_back(0, 2);
+		}
+		catch (const runtime_error&) {
+			thrown = true;
+		}
+		assert(thrown && v.size() == size && v.column<1>().data() == data);
+		assert(throw_on_copy::live == static_cast<int>(size));
+	}
+	assert(throw_on_copy::live == 0);
+	{ // a nothrow-moved column before a throwing copied one is not moved from
+		soa_vector<unique_ptr<int>, throw_on_copy_movable> v;
+		v.emplace_back(make_unique<int>(0), -1);
+		while (v.size() < v.capacity())
+			v.emplace_back(make_unique<int>(static_cast<int>(v.size())), 1);
+		bool thrown = false;
+		try {
+			v.emplace_back(make_unique<int>(-1), 2);
+		}
+		catch (const runtime_error&) {
+			thrown = true;
+		}
+		assert(thrown && v.size() == v.capacity());
+		for (size_t i = 0; i < v.size(); i++)
+			assert(v.column<0>()[i] && *v.column<0>()[i] == static_cast<int>(i));
+	}
+
+	cout << "soa_vector: ok" << endl;
+}
@@ -0,0 +1,91 @@
+#include <USTL/tuple_parallel.h>
+
+#include <iostream>
+#include <atomic>
+#include <cassert>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace Ubpa::USTL;
+using namespace std;
+
+struct system_a { int updates = 0; void update() { updates++; } };
+struct system_b { int updates = 0; void update() { updates += 2; } };
+struct system_c { int updates = 0; void update() { updates += 3; } };
+
+int main() {
+	thread_pool pool{ 4 };
+	assert(pool.size() == 4);
+
+	{ // fork_join runs every index once
+		vector<int> hits(1000);
+		pool.fork_join(hits.size(), [&](size_t i) { hits[i]++; });
+		for (auto h : hits)
+			assert(h == 1);
+	}
+
+	{ // nested fork_join inside tasks
+		atomic<size_t> sum{ 0 };
+		pool.fork_join(16, [&](size_t i) {
+			pool.fork_join(16, [&](size_t j) { sum += i * 16 + j; });
+		});
+		assert(sum == 255 * 256 / 2);
+	}
+
+	{ // the first exception is rethrown after the join
+		atomic<size_t> done{ 0 };
+		bool thrown = false;
+		try {
+			pool.fork_join(64, [&](size_t i) {
+				if (i == 13)
+					throw runtime_error{ "13" };
+				done++;
+			});
+		}
+		catch (const runtime_error& e) {
+			thrown = string{ e.what() } == "13";
+		}
+		assert(thrown && done == 63);
+	}
+
+	{ // tuple_for_each_parallel, with masks
+		tuple<system_a, system_b, system_c> systems;
+		tuple_for_each_parallel(systems, [](auto& s) { s.update(); }, pool);
+		tuple_for_each_parallel<true, false>(systems, [](auto& s) { s.update(); }, pool);
+		assert(get<0>(systems).updates == 2 && get<1>(systems).updates == 2 && get<2>(systems).updates == 6);
+
+		inline_executor inline_ex;
+		tuple_for_each_parallel(systems, [](auto& s) { s.update(); }, inline_ex);
+		assert(get<2>(systems).updates == 9);
+
+		// f is only instantiated for the enabled elements
+		tuple<system_a, int, system_c> mixed{ system_a{}, 7, system_c{} };
+		tuple_for_each_parallel<true, false, true>(mixed, [](auto& s) { s.update(); }, pool);
+		assert(get<0>(mixed).updates == 1 && get<1>(mixed) == 7 && get<2>(mixed).updates == 3);
+		const auto total = tuple_accumulate_parallel<true, false, true>(mixed, 0,
+			[](int a, int b) { return a + b; }, [](const auto& s) { return s.updates; }, pool);
+		assert(total == 4);
+	}
+
+	{ // tree reduction keeps the element order
+		const tuple<const char*, string, char, const char*, string, const char*, char> parts{
+			"a", "b", 'c', "d", "e", "f", 'g'
+		};
+		auto concat = [](string lhs, const string& rhs) { return lhs + rhs; };
+		auto to_str = [](const auto& e) {
+			if constexpr (is_same_v<decay_t<decltype(e)>, char>)
+				return string(1, e);
+			else
+				return string{ e };
+		};
+		assert(tuple_accumulate_parallel(parts, string{ ">" }, concat, to_str, pool) == ">abcdefg");
+		assert((tuple_accumulate_parallel<false, true, false>(parts, string{}, concat, to_str, pool) == "bdefg"));
+		assert((tuple_accumulate_parallel<false, false, false, false, false, false, false>(parts, string{ "-" }, concat, to_str, pool) == "-"));
+
+		const auto sum = tuple_accumulate_parallel(tuple{ 1, 2u, 3l, 4.5 }, 0.0, [](double a, double b) { return a + b; }, pool);
+		assert(sum == 10.5);
+	}
+
+	cout << "thread_pool: ok" << endl;
+}
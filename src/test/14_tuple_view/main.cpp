@@ -0,0 +1,72 @@
+#include <USTL/tuple_view.h>
+
+#include <iostream>
+#include <cassert>
+#include <memory>
+#include <string>
+
+using namespace Ubpa::USTL;
+using namespace std;
+
+int main() {
+	{ // concat
+		tuple<int, string> a{ 1, "two" };
+		tuple<double> b{ 3. };
+		auto ab = tuple_concat(a, b, tuple<char>{ '4' }); // the temporary is moved in
+		static_assert(tuple_size_v<decltype(ab)> == 4);
+		static_assert(is_same_v<tuple_element_t<1, decltype(ab)>, string>);
+		assert(&get<1>(ab) == &get<1>(a)); // no copy
+		get<0>(ab) = 10;
+		assert(get<0>(a) == 10 && get<3>(ab) == '4');
+
+		auto& [x, s, d, c] = ab;
+		s += "!";
+		assert(get<1>(a) == "two!" && x == 10 && d == 3. && c == '4');
+
+		// the tuple.h algorithms work unchanged
+		assert(tuple_find(ab, 3.) == 2);
+		static_assert(tuple_count_type<int, decltype(ab)> == 1);
+		size_t n = 0;
+		tuple_for_each(ab, [&](const auto&) { n++; });
+		assert(n == 4);
+		assert(tuple_visit_at(ab, 3, [](const auto& e) { return sizeof(e); }) == sizeof(char));
+
+		constexpr auto sum = tuple_accumulate(tuple_concat(tuple{ 1, 2 }, tuple{ 3 }), 0, [](int acc, int e) { return acc + e; });
+		static_assert(sum == 6);
+	}
+
+	{ // slice
+		tuple<int, float, string, char> t{ 1, 2.f, "three", '4' };
+		auto mid = tuple_slice<1, 3>(t);
+		static_assert(tuple_size_v<decltype(mid)> == 2);
+		assert(&get<0>(mid) == &get<1>(t) && get<1>(mid) == "three");
+		static_assert(tuple_size_v<decltype(tuple_slice<2, 2>(t))> == 0);
+
+		// views compose, and nest without dangling
+		auto rotated = tuple_concat(tuple_slice<1, 4>(t), tuple_slice<0, 1>(t));
+		assert(get<3>(rotated) == 1 && get<1>(rotated) == "three");
+		assert(tuple_materialize(rotated) == make_tuple(2.f, string{ "three" }, '4', 1));
+	}
+
+	{ // transform
+		const tuple<int, double, string> t{ 1, 2.5, "abc" };
+		auto sizes = tuple_transform(t, [](const auto& e) { return sizeof(e); });
+		static_assert(is_same_v<tuple_element_t<2, decltype(sizes)>, size_t>);
+		assert(get<1>(sizes) == sizeof(double));
+		assert(tuple_accumulate(sizes, size_t{ 0 }, [](size_t acc, size_t e) { return acc + e; })
+			== sizeof(int) + sizeof(double) + sizeof(string));
+
+		auto doubled = tuple_transform(tuple{ 1, 2, 3 }, [](int e) { return 2 * e; });
+		assert(tuple_materialize(doubled) == make_tuple(2, 4, 6));
+		auto [d0, d1, d2] = doubled;
+		assert(d0 + d1 + d2 == 12);
+	}
+
+	{ // rvalue views move the owned elements out
+		auto owned = tuple_concat(tuple{ make_unique<int>(1) }, tuple{ make_unique<int>(2) });
+		auto materialized = tuple_materialize(std::move(owned));
+		assert(*get<1>(materialized) == 2);
+	}
+
+	cout << "tuple_view: ok" << endl;
+}
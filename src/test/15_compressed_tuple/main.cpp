@@ -0,0 +1,64 @@
+#include <USTL/compressed_tuple.h>
+
+#include <iostream>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+using namespace Ubpa::USTL;
+using namespace std;
+
+struct Empty {};
+struct Hasher { size_t operator()(int x) const { return static_cast<size_t>(x) * 31; } };
+struct Comparator { bool operator()(int a, int b) const { return a < b; } };
+struct FinalEmpty final {};
+
+int main() {
+	using t1 = compressed_tuple<Empty, char, double, Hasher, int>;
+	using s1 = tuple<Empty, char, double, Hasher, int>;
+	static_assert(sizeof(t1) == 16); // double, int, char
+	static_assert(sizeof(t1) < sizeof(s1));
+
+	using t2 = compressed_tuple<char, int64_t, char, int32_t, char>;
+	static_assert(sizeof(t2) == 16);
+	static_assert(sizeof(t2) < sizeof(tuple<char, int64_t, char, int32_t, char>));
+
+	using t3 = compressed_tuple<allocator<int>, Hasher, Comparator, int*>; // policies + data
+	static_assert(sizeof(t3) == sizeof(int*));
+
+	static_assert(sizeof(compressed_tuple<FinalEmpty, int>) == 2 * sizeof(int)); // final: no EBO
+	static_assert(sizeof(compressed_tuple<Empty>) == 1);
+
+	// logical order is kept
+	constexpr t1 c{ Empty{}, 'c', 2.5, Hasher{}, 42 };
+	static_assert(get<1>(c) == 'c' && get<2>(c) == 2.5 && get<4>(c) == 42);
+	static_assert(is_same_v<tuple_element_t<2, t1>, double>);
+
+	compressed_tuple<string, int, Hasher> t{ "str", 1, Hasher{} };
+	auto& [s, i, h] = t;
+	s += "ing";
+	i = h(i);
+	assert(get<0>(t) == "string" && get<1>(t) == 31);
+
+	// tuple.h algorithms
+	assert(tuple_find(t, 31) == 1);
+	static_assert(tuple_index_of_type<Hasher, decltype(t)> == 2);
+	size_t n = 0;
+	tuple_for_each(t, [&](const auto&) { n++; });
+	assert(n == 3);
+
+	// references and move-only elements
+	int x = 0;
+	compressed_tuple<int&, unique_ptr<int>> r{ x, make_unique<int>(7) };
+	get<0>(r) = 5;
+	auto p = get<1>(std::move(r));
+	assert(x == 5 && *p == 7 && !get<1>(r));
+
+	compressed_tuple deduced{ 1, 2.f };
+	static_assert(is_same_v<decltype(deduced), compressed_tuple<int, float>>);
+
+	cout
+		<< "sizeof(compressed_tuple<Empty, char, double, Hasher, int>): " << sizeof(t1) << endl
+		<< "sizeof(std::tuple<Empty, char, double, Hasher, int>)      : " << sizeof(s1) << endl;
+}
@@ -0,0 +1,137 @@
+#include <USTL/tuple_serialize.h>
+#include <USTL/compressed_tuple.h>
+
+#include <iostream>
+#include <cassert>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace Ubpa::USTL;
+using namespace std;
+
+struct Point { float x, y; };
+
+int main() {
+	{ // runs
+		using plan = details::serialize_plan_of<serialize_format::raw, tuple<int, double, string, char, Point>>;
+		static_assert(plan::run_count == 3);
+		static_assert(plan::runs[0].raw && plan::runs[0].size == sizeof(int) + sizeof(double));
+		static_assert(!plan::runs[1].raw);
+		static_assert(plan::runs[2].begin == 3 && plan::runs[2].size == 1 + sizeof(Point));
+		static_assert(plan::raw_size == 21);
+
+		using varint_plan = details::serialize_plan_of<serialize_format::varint, tuple<int, double, bool>>;
+		static_assert(varint_plan::run_count == 2);
+
+		static_assert(is_serializable_tuple_v<tuple<int, string, vector<Point>, string_view>>);
+		static_assert(!is_serializable_tuple_v<tuple<int, vector<string>>>);
+		static_assert(!is_serializable_tuple_v<tuple<int*>>);
+		static_assert(!details::is_raw_v<string_view, serialize_format::raw>); // trivially copyable, but a view
+		static_assert(is_same_v<tuple_deserialize_view_t<tuple<int, string>>, tuple<int, string_view>>);
+	}
+	{ // raw
+		tuple<int, double, string, char, Point, vector<int16_t>> t{ 42, 3.5, "hello", 'c', { 1.f, 2.f }, { 1, -2, 3 } };
+		vector<char> buffer;
+		tuple_serialize(t, buffer);
+		assert(buffer.size() == tuple_serialized_size(t));
+		assert(buffer.size() == 4 + 8 + 1 + 5 + 1 + 8 + 1 + 6);
+
+		tuple<int, double, string, char, Point, vector<int16_t>> u;
+		const char* end = tuple_deserialize(buffer.data(), buffer.data() + buffer.size(), u);
+		assert(end == buffer.data() + buffer.size());
+		assert(get<0>(u) == 42 && get<1>(u) == 3.5 && get<2>(u) == "hello" && get<3>(u) == 'c');
+		assert(get<4>(u).x == 1.f && get<4>(u).y == 2.f);
+		assert((get<5>(u) == vector<int16_t>{ 1, -2, 3 }));
+
+		// zero-copy
+		tuple_deserialize_view_t<decltype(t)> v;
+		assert(tuple_deserialize(string_view{ buffer.data(), buffer.size() }, v) == end);
+		assert(get<2>(v) == "hello");
+		assert(get<2>(v).data() == buffer.data() + 13);
+
+		// truncated
+		for (size_t n = 0; n < buffer.size(); n++)
+			assert(tuple_deserialize(buffer.data(), buffer.data() + n, u) == nullptr);
+	}
+	{ // varint
+		tuple<int, uint64_t, int64_t, bool, uint8_t, string_view> t{ -1, 300, -64, true, 200, "abc" };
+		vector<char> buffer;
+		tuple_serialize<serialize_format::varint>(t, buffer);
+		assert(buffer.size() == 1 + 2 + 1 + 1 + 1 + 4);
+
+		tuple<int, uint64_t, int64_t, bool, uint8_t, string> u;
+		assert(tuple_deserialize<serialize_format::varint>(buffer.data(), buffer.data() + buffer.size(), u)
+			== buffer.data() + buffer.size());
+		assert(get<0>(u) == -1 && get<1>(u) == 300 && get<2>(u) == -64 && get<3>(u) && get<4>(u) == 200 && get<5>(u) == "abc");
+
+		tuple<int64_t, uint64_t> extremes{ INT64_MIN, UINT64_MAX };
+		buffer.clear();
+		tuple_serialize<serialize_format::varint>(extremes, buffer);
+		assert(buffer.size() == 20);
+		tuple<int64_t, uint64_t> e;
+		tuple_deserialize<serialize_format::varint>(buffer.data(), buffer.data() + buffer.size(), e);
+		assert(e == extremes);
+
+		const char overlong[11] = { '\x80', '\x80', '\x80', '\x80', '\x80', '\x80', '\x80', '\x80', '\x80', '\x80', '\x01' };
+		tuple<uint64_t> o;
+		assert(tuple_deserialize<serialize_format::varint>(overlong, overlong + 11, o) == nullptr);
+
+		// a value out of the field's range is malformed, not truncated
+		tuple<int32_t, uint32_t> wide{ 70000, 70000 };
+		buffer.clear();
+		tuple_serialize<serialize_format::varint>(wide, buffer);
+		tuple<int16_t, uint32_t> narrow_signed;
+		assert(tuple_deserialize<serialize_format::varint>(buffer.data(), buffer.data() + buffer.size(), narrow_signed) == nullptr);
+		tuple<int32_t, uint16_t> narrow_unsigned;
+		assert(tuple_deserialize<serialize_format::varint>(buffer.data(), buffer.data() + buffer.size(), narrow_unsigned) == nullptr);
+		tuple<int16_t, uint16_t> fits;
+		tuple<int32_t, uint32_t> small{ -30000, 60000 };
+		buffer.clear();
+		tuple_serialize<serialize_format::varint>(small, buffer);
+		assert(tuple_deserialize<serialize_format::varint>(buffer.data(), buffer.data() + buffer.size(), fits) != nullptr);
+		assert(get<0>(fits) == -30000 && get<1>(fits) == 60000);
+	}
+	{ // sinks produce the same bytes
+		tuple<int, string, Point, vector<char>> t{ 7, "sink", { 0.5f, -1.f }, { 'x', 'y' } };
+		vector<char> buffer;
+		tuple_serialize(t, buffer);
+
+		char storage[64];
+		fixed_buffer_writer writer{ storage };
+		tuple_serialize(t, writer);
+		assert(!writer.overflowed());
+		assert(writer.view() == string_view(buffer.data(), buffer.size()));
+
+		string flushed;
+		auto append = [&](string_view s) { flushed += s; };
+		{
+			output_sink<64> sink{ append };
+			for (int i = 0; i < 10; i++)
+				tuple_serialize(t, sink);
+		}
+		assert(flushed.size() == 10 * buffer.size());
+		assert(flushed.compare(0, buffer.size(), buffer.data(), buffer.size()) == 0);
+
+		char small[8];
+		fixed_buffer_writer small_writer{ small };
+		tuple_serialize(t, small_writer);
+		assert(small_writer.overflowed());
+	}
+	{ // other tuple-likes
+		compressed_tuple<char, double, string> t{ 'a', 2.0, "ct" };
+		vector<char> buffer;
+		tuple_serialize(t, buffer);
+		compressed_tuple<char, double, string> u;
+		tuple_deserialize(buffer.data(), buffer.data() + buffer.size(), u);
+		assert(get<0>(u) == 'a' && get<1>(u) == 2.0 && get<2>(u) == "ct");
+
+		tuple<> empty_tuple;
+		assert(tuple_serialized_size(empty_tuple) == 0);
+		assert(tuple_deserialize(buffer.data(), buffer.data(), empty_tuple) == buffer.data());
+	}
+
+	cout << "tuple_serialize test passed" << endl;
+	return 0;
+}
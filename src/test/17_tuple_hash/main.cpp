@@ -0,0 +1,84 @@
+#include <USTL/tuple_hash.h>
+#include <USTL/compressed_tuple.h>
+
+#include <iostream>
+#include <cassert>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace Ubpa::USTL;
+using namespace std;
+
+struct Cell { int32_t x, y; };
+struct Padded { char c; int32_t i; };
+
+int main() {
+	{ // runs
+		using plan = details::hash_plan_of<tuple<int32_t, uint64_t, string, Cell, double>>;
+		static_assert(plan::run_count == 4);
+		static_assert(plan::runs[0].raw && plan::runs[0].size == 12);
+		static_assert(plan::runs[2].raw && plan::runs[2].size == sizeof(Cell));
+		static_assert(!plan::runs[3].raw); // 0.0 == -0.0
+		static_assert(!details::hash_plan_of<tuple<Padded>>::runs[0].raw);
+		static_assert(details::hash_plan_of<tuple<const int&, int&&>>::run_count == 1); // references are raw too
+	}
+	{ // consistent with equality
+		tuple_hash h;
+		assert(h(tuple{ 1, 2, string{ "abc" } }) == h(tuple{ 1, 2, string{ "abc" } }));
+		assert(h(tuple{ 1, 2 }) != h(tuple{ 2, 1 }));
+		assert(h(tuple{ 0.0, 1 }) == h(tuple{ -0.0, 1 }));
+		assert(h(make_tuple(string{ "key" }, 3)) == h(make_tuple(string_view{ "key" }, 3)));
+		assert(h(tuple{ string{ "ab" }, string{ "c" } }) != h(tuple{ string{ "a" }, string{ "bc" } }));
+		assert(h(compressed_tuple<int, int>{ 1, 2 }) == h(tuple<int, int>{ 1, 2 }));
+		assert(h(tuple<>{}) == h(tuple<>{}));
+
+		// reference tuples hash like the values they refer to
+		int a = 1, b = 2;
+		string s = "key";
+		assert(h(tie(a, b)) == h(tuple<int, int>{ 1, 2 }));
+		assert(h(forward_as_tuple(a, 2)) == h(tuple<int, int>{ 1, 2 }));
+		assert(h(tie(s, a)) == h(make_tuple(string{ "key" }, 1)));
+		assert(h(forward_as_tuple(string_view{ s }, a)) == h(make_tuple(string{ "key" }, 1)));
+
+		tuple_equal eq;
+		assert(eq(make_tuple(string{ "key" }, 3), make_tuple(string_view{ "key" }, 3)));
+		assert(!eq(make_tuple(1, 2), make_tuple(1, 3)));
+		assert(eq(tie(a, b), tuple<int, int>{ 1, 2 }));
+	}
+	{ // bytes
+		string data(100, '\0');
+		for (size_t i = 0; i < data.size(); i++)
+			data[i] = static_cast<char>(i);
+		unordered_set<uint64_t> hashes;
+		for (size_t n = 0; n <= data.size(); n++)
+			hashes.insert(details::hash_bytes(data.data(), n, details::hash_k0));
+		assert(hashes.size() == data.size() + 1);
+	}
+	{ // distribution: low bits of small integer keys
+		unordered_set<size_t> buckets;
+		tuple_hash h;
+		for (int x = 0; x < 32; x++) {
+			for (int y = 0; y < 32; y++)
+				buckets.insert(h(tuple{ x, y }) & 1023);
+		}
+		assert(buckets.size() > 600); // ~647 expected for 1024 random values
+	}
+	{ // unordered_map keys
+		unordered_map<tuple<int, string, Cell*>, int, tuple_hash, tuple_equal> map;
+		Cell cell{ 1, 2 };
+		map[{ 1, "one", &cell }] = 1;
+		map[{ 2, "two", nullptr }] = 2;
+		assert((map.at({ 1, "one", &cell }) == 1));
+		assert((map.count({ 2, "two", &cell }) == 0));
+
+		unordered_map<tuple<float, string_view>, int, tuple_hash, tuple_equal> named; // std::hash<float>
+		named[{ 1.5f, "x" }] = 3;
+		assert((named.at({ 1.5f, "x" }) == 3));
+	}
+
+	cout << "tuple_hash test passed" << endl;
+	return 0;
+}
@@ -0,0 +1,80 @@
+#include <USTL/static_for.h>
+
+#include <iostream>
+#include <cassert>
+#include <array>
+#include <string>
+#include <tuple>
+
+using namespace Ubpa::USTL;
+using namespace std;
+
+constexpr size_t sum_indices() {
+	size_t sum = 0;
+	static_for<5>([&](auto i) { sum += i; });
+	return sum;
+}
+
+constexpr size_t sum_masked_indices() {
+	size_t sum = 0;
+	static_for_masked<true, false, true, false>([&](auto i) { sum += i; });
+	return sum;
+}
+
+constexpr int dot(const array<int, 4>& a, const array<int, 4>& b) {
+	int sum = 0;
+	static_for<4>([&](auto i) { sum += a[i] * b[i]; });
+	return sum;
+}
+
+int main() {
+	{ // static_for
+		static_assert(sum_indices() == 10);
+		static_assert(sum_masked_indices() == 2);
+		static_assert(dot({ 1, 2, 3, 4 }, { 5, 6, 7, 8 }) == 70);
+
+		// the index is a constant expression
+		tuple<int, string, double> t{ 1, "two", 3.0 };
+		string s;
+		static_for<tuple_size_v<decltype(t)>>([&](auto i) {
+			if constexpr (i == 1)
+				s += get<i>(t);
+			else
+				s += to_string(static_cast<int>(get<i>(t)));
+		});
+		assert(s == "1two3");
+
+		size_t calls = 0;
+		static_for<0>([&](auto) { calls++; });
+		assert(calls == 0);
+	}
+	{ // array_for_each
+		array<int, 5> a{ 1, 2, 3, 4, 5 };
+		array_for_each(a, [](int& x) { x *= 2; });
+		assert((a == array<int, 5>{ 2, 4, 6, 8, 10 }));
+
+		array_for_each<false, true>(a, [](int& x) { x = 0; });
+		assert((a == array<int, 5>{ 2, 0, 0, 0, 0 }));
+
+		float c[3] = { 1.f, 2.f, 3.f };
+		array_for_each<true, false, true>(c, [](float& x) { x = -x; });
+		assert(c[0] == -1.f && c[1] == 2.f && c[2] == -3.f);
+	}
+	{ // array_accumulate
+		constexpr array<int, 4> a{ 1, 2, 3, 4 };
+		static_assert(array_accumulate(a, 0, [](int acc, int x) { return acc + x; }) == 10);
+		static_assert(array_accumulate<true, false, true>(a, 0, [](int acc, int x) { return acc + x; }) == 1 + 3 + 4);
+
+		// left fold, in order
+		const string words[3] = { "a", "b", "c" };
+		assert(array_accumulate(words, string{ ">" }, [](string acc, const string& w) { return acc + w; }) == ">abc");
+
+		// the accumulator keeps the type of init
+		auto mean = array_accumulate(a, 0.0, [](double acc, int x) { return acc + x / 4.0; });
+		static_assert(is_same_v<decltype(mean), double>);
+		assert(mean == 2.5);
+	}
+
+	cout << "static_for test passed" << endl;
+	return 0;
+}
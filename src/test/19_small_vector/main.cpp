@@ -0,0 +1,200 @@
+#include <USTL/small_vector.h>
+
+#include <iostream>
+#include <cassert>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace Ubpa::USTL;
+using namespace std;
+
+// counts live objects, copies throw on demand
+struct Tracked {
+	static inline int live = 0;
+	static inline int copies_until_throw = -1;
+
+	int value;
+
+	Tracked(int v = 0) : value{ v } { live++; }
+	Tracked(const Tracked& other) : value{ other.value } {
+		if (copies_until_throw >= 0 && copies_until_throw-- == 0)
+			throw runtime_error{ "copy" };
+		live++;
+	}
+	Tracked(Tracked&& other) noexcept : value{ other.value } { live++; other.value = -1; }
+	Tracked& operator=(const Tracked&) = default;
+	Tracked& operator=(Tracked&& other) noexcept { value = other.value; other.value = -1; return *this; }
+	~Tracked() { live--; }
+
+	friend bool operator==(const Tracked& a, const Tracked& b) { return a.value == b.value; }
+};
+
+// stateful, never propagated
+template<typename T>
+struct ArenaAllocator {
+	using value_type = T;
+	int id;
+
+	explicit ArenaAllocator(int id) : id{ id } {}
+	template<typename U>
+	ArenaAllocator(const ArenaAllocator<U>& other) : id{ other.id } {}
+
+	T* allocate(size_t n) { return allocator<T>{}.allocate(n); }
+	void deallocate(T* p, size_t n) { allocator<T>{}.deallocate(p, n); }
+
+	friend bool operator==(const ArenaAllocator& a, const ArenaAllocator& b) { return a.id == b.id; }
+	friend bool operator!=(const ArenaAllocator& a, const ArenaAllocator& b) { return a.id != b.id; }
+};
+
+// stateful, propagated on swap; a buffer must be freed by the allocator that made it
+template<typename T>
+struct SwapAllocator {
+	using value_type = T;
+	using propagate_on_container_swap = true_type;
+	static inline map<const void*, int> owners;
+	int id;
+
+	explicit SwapAllocator(int id) : id{ id } {}
+	template<typename U>
+	SwapAllocator(const SwapAllocator<U>& other) : id{ other.id } {}
+
+	T* allocate(size_t n) {
+		T* p = allocator<T>{}.allocate(n);
+		owners[p] = id;
+		return p;
+	}
+	void deallocate(T* p, size_t n) {
+		assert(owners.at(p) == id);
+		owners.erase(p);
+		allocator<T>{}.deallocate(p, n);
+	}
+
+	friend bool operator==(const SwapAllocator& a, const SwapAllocator& b) { return a.id == b.id; }
+	friend bool operator!=(const SwapAllocator& a, const SwapAllocator& b) { return a.id != b.id; }
+};
+
+template<typename V>
+vector<int> values(const V& v) {
+	vector<int> rst;
+	for (const auto& e : v)
+		rst.push_back(static_cast<int>(e.value));
+	return rst;
+}
+
+int main() {
+	{ // layout
+		static_assert(sizeof(small_vector<int, 4>) == sizeof(int*) + 2 * sizeof(size_t) + 4 * sizeof(int)); // no allocator
+		static_assert(sizeof(small_vector<int, 4, ArenaAllocator<int>>) > sizeof(small_vector<int, 4>));
+		static_assert(details::is_trivially_relocatable_v<int, allocator<int>>);
+		static_assert(!details::is_trivially_relocatable_v<string, allocator<string>>);
+	}
+	{ // inline, then heap
+		small_vector<int, 4> v;
+		assert(v.empty() && v.is_inline() && v.capacity() == 4);
+		for (int i = 0; i < 4; i++)
+			v.push_back(i);
+		assert(v.is_inline());
+		v.push_back(v[0]); // aliasing across growth
+		assert(!v.is_inline() && v.size() == 5 && v.back() == 0);
+		assert((v == small_vector<int, 4>{ 0, 1, 2, 3, 0 }));
+
+		v.erase(v.begin() + 1, v.begin() + 3);
+		assert((v == small_vector<int, 4>{ 0, 3, 0 }));
+		v.shrink_to_fit();
+		assert(v.is_inline() && v.capacity() == 4);
+
+		v.insert(v.begin() + 1, v[2]);
+		v.insert(v.begin(), { 7, 8 });
+		v.insert(v.end(), 2, v[0]);
+		assert((v == small_vector<int, 4>{ 7, 8, 0, 0, 3, 0, 7, 7 }));
+		v.resize(2);
+		v.resize(4, 9);
+		assert((v == small_vector<int, 4>{ 7, 8, 9, 9 }));
+		assert(v.at(3) == 9);
+		bool thrown = false;
+		try { v.at(4); } catch (const out_of_range&) { thrown = true; }
+		assert(thrown);
+
+		assert((small_vector<int, 4>{ 1, 2 } < small_vector<int, 4>{ 1, 3 }));
+		assert((small_vector<int, 4>(3, 5) == small_vector<int, 4>{ 5, 5, 5 }));
+		const int raw[] = { 4, 5, 6 };
+		assert((small_vector<int, 2>(begin(raw), end(raw)).size() == 3));
+		vector<int> reversed(v.rbegin(), v.rend());
+		assert((reversed == vector<int>{ 9, 9, 8, 7 }));
+	}
+	{ // non-trivial elements
+		{
+			small_vector<Tracked, 2> v;
+			for (int i = 0; i < 6; i++)
+				v.emplace_back(i);
+			v.emplace(v.begin(), v[5]);
+			v.erase(v.begin() + 2);
+			assert((values(v) == vector<int>{ 5, 0, 2, 3, 4, 5 }));
+			assert(Tracked::live == 6);
+
+			small_vector<Tracked, 2> copy{ v };
+			small_vector<Tracked, 2> moved{ std::move(copy) }; // heap: the buffer is stolen
+			assert(copy.empty() && copy.is_inline());
+			assert(values(moved) == values(v));
+
+			small_vector<Tracked, 2> small{ Tracked{ 1 } };
+			small_vector<Tracked, 2> moved_small{ std::move(small) }; // inline: moved one by one
+			assert(moved_small.size() == 1 && moved_small[0].value == 1 && small.empty());
+
+			swap(moved_small, moved);
+			assert(moved.size() == 1 && moved_small.size() == 6 && moved_small[0].value == 5);
+			moved = moved_small;
+			assert(values(moved) == values(moved_small));
+			moved = { Tracked{ 3 } };
+			assert(values(moved) == vector<int>{ 3 });
+		}
+		assert(Tracked::live == 0);
+	}
+	{ // the new element is built before growing, if that throws nothing changed
+		small_vector<Tracked, 2> v{ Tracked{ 1 }, Tracked{ 2 } };
+		Tracked::copies_until_throw = 0;
+		bool thrown = false;
+		try { v.push_back(v[0]); } catch (const runtime_error&) { thrown = true; }
+		Tracked::copies_until_throw = -1;
+		assert(thrown && v.size() == 2 && v.is_inline() && (values(v) == vector<int>{ 1, 2 }));
+	}
+	assert(Tracked::live == 0);
+	{ // stateful allocator
+		using V = small_vector<int, 2, ArenaAllocator<int>>;
+		V a{ ArenaAllocator<int>{ 1 } };
+		a.assign({ 1, 2, 3 });
+		V b{ std::move(a) };
+		assert(b.get_allocator().id == 1 && b.size() == 3);
+
+		V c{ ArenaAllocator<int>{ 2 } };
+		c = std::move(b); // different allocators, elements are moved
+		assert(c.get_allocator().id == 2 && (values(vector<Tracked>(c.begin(), c.end())) == vector<int>{ 1, 2, 3 }));
+	}
+
+	{ // swap with propagated allocators, a heap buffer moves with its allocator
+		using V = small_vector<int, 2, SwapAllocator<int>>;
+		{
+			V a{ SwapAllocator<int>{ 1 } };
+			V b{ SwapAllocator<int>{ 2 } };
+			a.assign({ 1 });
+			b.assign({ 2, 3, 4 });
+			a.swap(b);
+			assert(a.get_allocator().id == 2 && !a.is_inline() && a.size() == 3 && a[2] == 4);
+			assert(b.get_allocator().id == 1 && b.is_inline() && b.size() == 1 && b[0] == 1);
+			b.swap(a);
+			assert(b.get_allocator().id == 2 && !b.is_inline() && a.get_allocator().id == 1 && a.is_inline());
+
+			V c{ SwapAllocator<int>{ 3 } };
+			c.assign({ 5, 6, 7, 8 });
+			b.swap(c); // both on the heap
+			assert(b.get_allocator().id == 3 && b.size() == 4 && c.get_allocator().id == 2 && c.size() == 3);
+		}
+		assert(SwapAllocator<int>::owners.empty());
+	}
+
+	cout << "small_vector test passed" << endl;
+	return 0;
+}
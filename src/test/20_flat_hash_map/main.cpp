@@ -0,0 +1,283 @@
+#include <USTL/flat_hash_map.h>
+#include <USTL/memory.h>
+#include <USTL/tuple_hash.h>
+
+#include <iostream>
+#include <cassert>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+using namespace Ubpa::USTL;
+using namespace std;
+
+// counts live objects
+struct Tracked {
+	static inline int live = 0;
+
+	int value;
+
+	Tracked(int v = 0) : value{ v } { live++; }
+	Tracked(const Tracked& other) : value{ other.value } { live++; }
+	Tracked(Tracked&& other) noexcept : value{ other.value } { live++; }
+	Tracked& operator=(const Tracked&) = default;
+	~Tracked() { live--; }
+};
+
+// copies and moves throw on demand, moving is not noexcept
+struct Throwing {
+	static inline int live = 0;
+	static inline int ops_until_throw = -1;
+
+	static void tick() {
+		if (ops_until_throw >= 0 && ops_until_throw-- == 0)
+			throw runtime_error{ "op" };
+	}
+
+	int value;
+
+	Throwing(int v = 0) : value{ v } { live++; }
+	Throwing(const Throwing& other) : value{ other.value } { tick(); live++; }
+	Throwing(Throwing&& other) : value{ other.value } { tick(); live++; }
+	~Throwing() { live--; }
+};
+
+// moves throw on demand, no copies
+struct ThrowingMoveOnly {
+	int value;
+
+	ThrowingMoveOnly(int v = 0) : value{ v } { Throwing::live++; }
+	ThrowingMoveOnly(const ThrowingMoveOnly&) = delete;
+	ThrowingMoveOnly(ThrowingMoveOnly&& other) : value{ other.value } { Throwing::tick(); Throwing::live++; }
+	~ThrowingMoveOnly() { Throwing::live--; }
+};
+
+// throws on demand
+struct ThrowingHash {
+	static inline int calls_until_throw = -1;
+
+	size_t operator()(const string& key) const {
+		if (calls_until_throw >= 0 && calls_until_throw-- == 0)
+			throw runtime_error{ "hash" };
+		return hash<string>{}(key);
+	}
+};
+
+// all keys collide, the probing alone tells them apart
+struct BadHash {
+	size_t operator()(int) const noexcept { return 42; }
+};
+
+int main() {
+	{ // layout
+		using M = flat_hash_map<int, int>;
+		static_assert(sizeof(M) == 2 * sizeof(void*) + 3 * sizeof(size_t)); // no hasher / key_equal / allocator
+		static_assert(sizeof(flat_hash_set<shared_object<int>>) == sizeof(M));
+		static_assert(is_same_v<M::iterator::reference, pair<const int, int>&>);
+		static_assert(is_same_v<flat_hash_set<int>::iterator, flat_hash_set<int>::const_iterator>);
+	}
+	{ // basic
+		flat_hash_map<int, string> m;
+		assert(m.empty() && m.begin() == m.end() && m.find(1) == m.end() && m.bucket_count() == 0);
+		for (int i = 0; i < 1000; i++)
+			assert(m.emplace(i, to_string(i)).second);
+		assert(!m.emplace(3, "x").second && m[3] == "3");
+		assert(m.size() == 1000 && m.load_factor() <= m.max_load_factor());
+		for (int i = 0; i < 1000; i++)
+			assert(m.at(i) == to_string(i) && m.contains(i) && m.count(i) == 1);
+		assert(!m.contains(1000) && m.count(-1) == 0);
+		bool thrown = false;
+		try { m.at(1000); } catch (const out_of_range&) { thrown = true; }
+		assert(thrown);
+
+		map<int, string> expected;
+		for (const auto& [k, v] : m)
+			expected.emplace(k, v);
+		assert(expected.size() == 1000 && expected.begin()->first == 0 && expected.rbegin()->first == 999);
+
+		m[1000] = "1000";
+		assert(m.insert_or_assign(1000, "x").second == false && m[1000] == "x");
+		assert(m.try_emplace(1001, 3, 'a').first->second == "aaa");
+		assert(m.insert({ 1002, "b" }).second && m.insert(pair<int, const char*>{ 1003, "c" }).second);
+		assert(m.size() == 1004);
+	}
+	{ // erase, deleted marks are reused and dropped by a rehash
+		flat_hash_map<int, int> m;
+		for (int i = 0; i < 100; i++)
+			m[i] = i;
+		for (int i = 0; i < 100; i += 2)
+			assert(m.erase(i) == 1);
+		assert(m.erase(0) == 0 && m.size() == 50);
+		for (int i = 0; i < 100; i++)
+			assert(m.contains(i) == (i % 2 == 1));
+		const size_t capacity = m.bucket_count();
+		for (int round = 0; round < 100; round++) { // churn does not grow the table
+			m[1000 + round] = round;
+			m.erase(1000 + round);
+		}
+		assert(m.bucket_count() == capacity && m.size() == 50);
+
+		for (auto it = m.begin(); it != m.end();) {
+			if (it->first % 4 == 1)
+				it = m.erase(it);
+			else
+				++it;
+		}
+		assert(m.size() == 25);
+		for (const auto& [k, v] : m)
+			assert(k % 4 == 3 && k == v);
+		m.rehash(0);
+		assert(m.size() == 25 && m.at(99) == 99);
+		m.erase(m.begin(), m.end());
+		assert(m.empty());
+		m.rehash(0);
+		assert(m.bucket_count() == 0);
+	}
+	{ // collisions
+		flat_hash_set<int, BadHash> s;
+		for (int i = 0; i < 200; i++)
+			assert(s.insert(i).second);
+		for (int i = 0; i < 200; i += 3)
+			s.erase(i);
+		for (int i = 0; i < 200; i++)
+			assert(s.contains(i) == (i % 3 != 0));
+	}
+	{ // reserve, copy, move, swap, ==
+		flat_hash_map<string, int> a;
+		a.reserve(100);
+		const size_t capacity = a.bucket_count();
+		for (int i = 0; i < 100; i++)
+			a.emplace(to_string(i), i);
+		assert(a.bucket_count() == capacity);
+
+		flat_hash_map<string, int> b{ a };
+		assert(a == b);
+		b["0"] = -1;
+		assert(a != b);
+		flat_hash_map<string, int> c{ std::move(b) };
+		assert(b.empty() && c.size() == 100 && c.at("0") == -1);
+		b = c;
+		assert(b == c);
+		c = std::move(a);
+		assert(a.empty() && c.at("0") == 0);
+		swap(a, c);
+		assert(c.empty() && a.size() == 100);
+		a.clear();
+		assert(a.empty() && a.begin() == a.end() && !a.contains("1"));
+
+		flat_hash_set<int> s1{ 1, 2, 3 };
+		flat_hash_set<int> s2{ 3, 2, 1, 1 };
+		assert(s1 == s2 && s2.size() == 3);
+	}
+	{ // non-trivial elements are destroyed
+		{
+			flat_hash_map<int, Tracked> m;
+			for (int i = 0; i < 100; i++)
+				m.try_emplace(i, i);
+			m.erase(5);
+			auto copy = m;
+			copy.clear();
+			assert(Tracked::live == 99);
+		}
+		assert(Tracked::live == 0);
+	}
+	{ // a throw in a rehash copies: the table is unchanged
+		{
+			flat_hash_map<int, Throwing> m;
+			for (int i = 0; i < 14; i++) // full at capacity 16
+				m.try_emplace(i, i);
+			assert(m.bucket_count() == 16);
+			Throwing::ops_until_throw = 4;
+			bool thrown = false;
+			try { m.try_emplace(14, 14); } catch (const runtime_error&) { thrown = true; }
+			Throwing::ops_until_throw = -1;
+			assert(thrown && m.size() == 14 && m.bucket_count() == 16 && !m.contains(14));
+			for (int i = 0; i < 14; i++)
+				assert(m.at(i).value == i);
+			assert(Throwing::live == 14);
+			m.try_emplace(14, 14);
+			assert(m.size() == 15 && m.at(14).value == 14);
+		}
+		assert(Throwing::live == 0);
+	}
+	{ // move-only with a throwing move: elements may be lost, nothing leaks
+		{
+			flat_hash_map<int, ThrowingMoveOnly> m;
+			for (int i = 0; i < 14; i++)
+				m.try_emplace(i, i);
+			Throwing::ops_until_throw = 4;
+			bool thrown = false;
+			try { m.try_emplace(14, 14); } catch (const runtime_error&) { thrown = true; }
+			Throwing::ops_until_throw = -1;
+			assert(thrown && m.size() < 14 && Throwing::live == static_cast<int>(m.size()));
+			size_t n = 0;
+			for (const auto& [k, v] : m) {
+				assert(k == v.value && m.contains(k));
+				n++;
+			}
+			assert(n == m.size());
+		}
+		assert(Throwing::live == 0);
+	}
+	{ // a throw from the hasher in a rehash (the moves are noexcept): the table is unchanged
+		flat_hash_map<string, int, ThrowingHash> m;
+		for (int i = 0; i < 14; i++)
+			m.emplace(string(32, static_cast<char>('a' + i)), i);
+		assert(m.bucket_count() == 16);
+		ThrowingHash::calls_until_throw = 6;
+		bool thrown = false;
+		try { m.emplace(string(32, 'z'), 14); } catch (const runtime_error&) { thrown = true; }
+		ThrowingHash::calls_until_throw = -1;
+		assert(thrown && m.size() == 14 && m.bucket_count() == 16);
+		for (int i = 0; i < 14; i++)
+			assert(m.at(string(32, static_cast<char>('a' + i))) == i);
+		for (const auto& [k, v] : m)
+			assert(k.size() == 32);
+		m.emplace(string(32, 'z'), 14);
+		assert(m.size() == 15 && m.at(string(32, 'z')) == 14);
+	}
+	{ // shared_object / unique_object keys, through the std::hash specializations
+		flat_hash_map<shared_object<int>, size_t> m;
+		vector<shared_object<int>> keys;
+		for (int i = 0; i < 100; i++)
+			keys.push_back(make_shared_object<int>(i));
+		for (size_t i = 0; i < keys.size(); i++)
+			m[keys[i]] = i; // a non-const lvalue key is copied
+		for (size_t i = 0; i < keys.size(); i++)
+			assert(m.at(keys[i]) == i && *m.find(keys[i])->first == static_cast<int>(i));
+		assert(!m.contains(make_shared_object<int>(0)));
+		m.erase(keys[7]);
+		assert(m.size() == 99 && keys[7].use_count() == 1 && keys[8].use_count() == 2);
+
+		flat_hash_map<unique_object<int>, int> u;
+		vector<const int*> raws;
+		for (int i = 0; i < 50; i++) {
+			auto key = make_unique_object<int>(i);
+			raws.push_back(key.get());
+			u.emplace(std::move(key), i); // rehashes move the keys
+		}
+		int sum = 0;
+		for (const auto& [k, v] : u) {
+			assert(*k == v && k.get() == raws[v]);
+			sum += v;
+		}
+		assert(sum == 49 * 50 / 2);
+
+		flat_hash_set<shared_object<int>> s;
+		s.emplace(keys[0]);
+		assert(s.contains(keys[0]) && !s.contains(keys[1]));
+	}
+	{ // heterogeneous lookup with transparent tuple_hash / tuple_equal
+		flat_hash_map<tuple<string, int>, int, tuple_hash, tuple_equal> m;
+		m.emplace(tuple<string, int>{ "a", 1 }, 1);
+		m.emplace(tuple<string, int>{ "b", 2 }, 2);
+		assert(m.find(tuple<string_view, int>{ "a", 1 })->second == 1);
+		assert(m.contains(tuple<string_view, int>{ "b", 2 }) && !m.contains(tuple<string_view, int>{ "b", 1 }));
+	}
+
+	cout << "ok" << endl;
+}